@@ -6,8 +6,10 @@
  */
 
 #include <AK/Assertions.h>
+#include <AK/BinarySearch.h>
 #include <AK/Format.h>
 #include <AK/Platform.h>
+#include <AK/QuickSort.h>
 #include <AK/Random.h>
 #include <AK/Vector.h>
 #include <LibGC/BlockAllocator.h>
@@ -30,81 +32,183 @@
 
 namespace GC {
 
-BlockAllocator::~BlockAllocator()
+static void unmap_region(u8* base, size_t block_count)
 {
-    for (auto* block : m_blocks) {
-        ASAN_UNPOISON_MEMORY_REGION(block, HeapBlock::block_size);
+    auto region_size = block_count * HeapBlock::block_size;
+    ASAN_UNPOISON_MEMORY_REGION(base, region_size);
 #if !defined(AK_OS_WINDOWS)
-        if (munmap(block, HeapBlock::block_size) < 0) {
-            perror("munmap");
-            VERIFY_NOT_REACHED();
-        }
+    if (munmap(base, region_size) < 0) {
+        perror("munmap");
+        VERIFY_NOT_REACHED();
+    }
 #else
-        if (!VirtualFree(block, 0, MEM_RELEASE)) {
-            warnln("{}", Error::from_windows_error());
-            VERIFY_NOT_REACHED();
-        }
+    if (!VirtualFree(base, 0, MEM_RELEASE)) {
+        warnln("{}", Error::from_windows_error());
+        VERIFY_NOT_REACHED();
+    }
 #endif
+}
+
+BlockAllocator::~BlockAllocator()
+{
+    // NOTE: Blocks may still be in use if a heap outlives this allocator (e.g. at process exit), in which case we leave
+    //       their regions mapped rather than pulling memory out from under them.
+    for (auto& region : m_regions) {
+        if (region.allocated_block_count == 0)
+            unmap_region(region.base, region.block_count);
     }
 }
 
 void* BlockAllocator::allocate_block([[maybe_unused]] char const* name)
 {
-    if (!m_blocks.is_empty()) {
+    ++m_allocated_block_count;
+
+    // NOTE: Prefer blocks that are still committed, since reusing them doesn't fault in fresh pages.
+    for (auto* cache : { &m_blocks_pending_decommit, &m_blocks }) {
+        if (cache->is_empty())
+            continue;
         // To reduce predictability, take a random block from the cache.
-        size_t random_index = get_random_uniform(m_blocks.size());
-        auto* block = m_blocks.unstable_take(random_index);
+        size_t random_index = get_random_uniform(cache->size());
+        auto* block = cache->unstable_take(random_index);
+        ++m_regions[index_of_region_containing(block)].allocated_block_count;
         ASAN_UNPOISON_MEMORY_REGION(block, HeapBlock::block_size);
         LSAN_REGISTER_ROOT_REGION(block, HeapBlock::block_size);
         return block;
     }
 
+    if (m_next_unused_block == m_end_of_current_region)
+        reserve_region();
+
+    auto* block = m_next_unused_block;
+    m_next_unused_block += HeapBlock::block_size;
+    ++m_regions[index_of_region_containing(block)].allocated_block_count;
+    LSAN_REGISTER_ROOT_REGION(block, HeapBlock::block_size);
+    return block;
+}
+
+void BlockAllocator::reserve_region()
+{
+    // NOTE: Start small so that rarely used cell types don't reserve much, and grow geometrically for busy ones.
+    auto block_count = m_current_region_block_count == 0 ? min_blocks_per_region : min(m_current_region_block_count * 2, max_blocks_per_region);
+    auto region_size = block_count * HeapBlock::block_size;
+
 #if !defined(AK_OS_WINDOWS)
-    auto* block = (HeapBlock*)mmap(nullptr, HeapBlock::block_size, PROT_READ | PROT_WRITE, MAP_ANONYMOUS | MAP_PRIVATE, -1, 0);
-    VERIFY(block != MAP_FAILED);
+    auto* base = static_cast<u8*>(mmap(nullptr, region_size, PROT_READ | PROT_WRITE, MAP_ANONYMOUS | MAP_PRIVATE, -1, 0));
+    VERIFY(base != MAP_FAILED);
 #else
-    auto* block = (HeapBlock*)VirtualAlloc(NULL, HeapBlock::block_size, MEM_COMMIT, PAGE_READWRITE);
-    VERIFY(block);
+    auto* base = static_cast<u8*>(VirtualAlloc(NULL, region_size, MEM_RESERVE | MEM_COMMIT, PAGE_READWRITE));
+    VERIFY(base);
 #endif
-    LSAN_REGISTER_ROOT_REGION(block, HeapBlock::block_size);
-    return block;
+
+    size_t index = 0;
+    while (index < m_regions.size() && m_regions[index].base < base)
+        ++index;
+    m_regions.insert(index, { .base = base, .block_count = block_count });
+
+    m_next_unused_block = base;
+    m_end_of_current_region = base + region_size;
+    m_current_region_block_count = block_count;
+}
+
+void BlockAllocator::release_region(size_t index)
+{
+    auto region = m_regions.take(index);
+    auto* region_end = region.base + region.block_count * HeapBlock::block_size;
+    auto is_in_region = [&](void* block) { return block >= region.base && block < region_end; };
+    m_blocks_pending_decommit.remove_all_matching(is_in_region);
+    m_blocks.remove_all_matching(is_in_region);
+    unmap_region(region.base, region.block_count);
+}
+
+size_t BlockAllocator::index_of_region_containing(void* block) const
+{
+    size_t index = 0;
+    auto* region = binary_search(m_regions, static_cast<u8*>(block), &index, [](u8* block, Region const& region) {
+        if (block < region.base)
+            return -1;
+        if (block >= region.base + region.block_count * HeapBlock::block_size)
+            return 1;
+        return 0;
+    });
+    VERIFY(region);
+    return index;
 }
 
 void BlockAllocator::deallocate_block(void* block)
 {
     VERIFY(block);
+    VERIFY(m_allocated_block_count > 0);
+    --m_allocated_block_count;
 
-#if defined(AK_OS_WINDOWS)
-    DWORD ret = DiscardVirtualMemory(block, HeapBlock::block_size);
-    if (ret != ERROR_SUCCESS) {
-        warnln("{}", Error::from_windows_error(ret));
-        VERIFY_NOT_REACHED();
+    ASAN_POISON_MEMORY_REGION(block, HeapBlock::block_size);
+    LSAN_UNREGISTER_ROOT_REGION(block, HeapBlock::block_size);
+    m_blocks_pending_decommit.append(block);
+
+    // NOTE: We keep the region that new blocks are carved from, even when it's empty, as we'll likely need it again soon.
+    auto region_index = index_of_region_containing(block);
+    auto& region = m_regions[region_index];
+    if (--region.allocated_block_count == 0 && region.base + region.block_count * HeapBlock::block_size != m_end_of_current_region) {
+        release_region(region_index);
+        return;
     }
+
+    if (m_blocks_pending_decommit.size() >= decommit_batch_size)
+        decommit_pending_blocks();
+}
+
+void BlockAllocator::decommit_pending_blocks()
+{
+    if (m_blocks_pending_decommit.is_empty())
+        return;
+
+    // NOTE: Blocks that came from the same region are often adjacent, so we sort them and return each contiguous run
+    //       to the operating system with a single call.
+    quick_sort(m_blocks_pending_decommit);
+
+    auto decommit = [](void* start, size_t size) {
+        ASAN_UNPOISON_MEMORY_REGION(start, size);
+#if defined(AK_OS_WINDOWS)
+        DWORD ret = DiscardVirtualMemory(start, size);
+        if (ret != ERROR_SUCCESS) {
+            warnln("{}", Error::from_windows_error(ret));
+            VERIFY_NOT_REACHED();
+        }
 #elif defined(USE_FALLBACK_BLOCK_DEALLOCATION)
-    // If we can't use any of the nicer techniques, unmap and remap the block to return the physical pages while keeping the VM.
-    if (munmap(block, HeapBlock::block_size) < 0) {
-        perror("munmap");
-        VERIFY_NOT_REACHED();
-    }
-    if (mmap(block, HeapBlock::block_size, PROT_READ | PROT_WRITE, MAP_ANONYMOUS | MAP_PRIVATE | MAP_FIXED, -1, 0) != block) {
-        perror("mmap");
-        VERIFY_NOT_REACHED();
-    }
+        // If we can't use any of the nicer techniques, unmap and remap the blocks to return the physical pages while keeping the VM.
+        if (munmap(start, size) < 0) {
+            perror("munmap");
+            VERIFY_NOT_REACHED();
+        }
+        if (mmap(start, size, PROT_READ | PROT_WRITE, MAP_ANONYMOUS | MAP_PRIVATE | MAP_FIXED, -1, 0) != start) {
+            perror("mmap");
+            VERIFY_NOT_REACHED();
+        }
 #elif defined(MADV_FREE)
-    if (madvise(block, HeapBlock::block_size, MADV_FREE) < 0) {
-        perror("madvise(MADV_FREE)");
-        VERIFY_NOT_REACHED();
-    }
+        if (madvise(start, size, MADV_FREE) < 0) {
+            perror("madvise(MADV_FREE)");
+            VERIFY_NOT_REACHED();
+        }
 #elif defined(MADV_DONTNEED)
-    if (madvise(block, HeapBlock::block_size, MADV_DONTNEED) < 0) {
-        perror("madvise(MADV_DONTNEED)");
-        VERIFY_NOT_REACHED();
-    }
+        if (madvise(start, size, MADV_DONTNEED) < 0) {
+            perror("madvise(MADV_DONTNEED)");
+            VERIFY_NOT_REACHED();
+        }
 #endif
+        ASAN_POISON_MEMORY_REGION(start, size);
+    };
 
-    ASAN_POISON_MEMORY_REGION(block, HeapBlock::block_size);
-    LSAN_UNREGISTER_ROOT_REGION(block, HeapBlock::block_size);
-    m_blocks.append(block);
+    size_t run_start = 0;
+    for (size_t i = 1; i <= m_blocks_pending_decommit.size(); ++i) {
+        auto* previous_block = static_cast<u8*>(m_blocks_pending_decommit[i - 1]);
+        if (i < m_blocks_pending_decommit.size() && m_blocks_pending_decommit[i] == previous_block + HeapBlock::block_size)
+            continue;
+        auto* run_start_block = m_blocks_pending_decommit[run_start];
+        decommit(run_start_block, (i - run_start) * HeapBlock::block_size);
+        run_start = i;
+    }
+
+    m_blocks.extend(move(m_blocks_pending_decommit));
+    m_blocks_pending_decommit.clear();
 }
 
 }
@@ -11,6 +11,9 @@
 
 namespace GC {
 
+// Hands out HeapBlock-sized blocks carved from larger contiguous regions of address space.
+// Freed blocks are decommitted in batches and reused before any new region is reserved.
+// Once every block of a region has been freed, the whole region is unmapped.
 class GC_API BlockAllocator {
 public:
     BlockAllocator() = default;
@@ -19,7 +22,37 @@ public:
     void* allocate_block(char const* name);
     void deallocate_block(void*);
 
+    // Returns the memory of all freed blocks to the operating system without waiting for a full batch.
+    void decommit_pending_blocks();
+
+    size_t region_count() const { return m_regions.size(); }
+
 private:
+    static constexpr size_t min_blocks_per_region = 16;
+    static constexpr size_t max_blocks_per_region = 256;
+    static constexpr size_t decommit_batch_size = 32;
+
+    struct Region {
+        u8* base { nullptr };
+        size_t block_count { 0 };
+        size_t allocated_block_count { 0 };
+    };
+
+    void reserve_region();
+    void release_region(size_t index);
+    size_t index_of_region_containing(void* block) const;
+
+    // Sorted by base address.
+    Vector<Region> m_regions;
+    u8* m_next_unused_block { nullptr };
+    u8* m_end_of_current_region { nullptr };
+    size_t m_current_region_block_count { 0 };
+    size_t m_allocated_block_count { 0 };
+
+    // Freed blocks whose memory is still committed.
+    Vector<void*> m_blocks_pending_decommit;
+
+    // Freed blocks whose memory has been returned to the operating system.
     Vector<void*> m_blocks;
 };
 
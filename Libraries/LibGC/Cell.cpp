@@ -9,6 +9,25 @@
 
 namespace GC {
 
+Cell::~Cell()
+{
+    if (m_overrides_must_survive_garbage_collection)
+        HeapBlockBase::from_cell(this)->did_remove_cell_that_overrides_must_survive_garbage_collection({});
+}
+
+void Cell::set_overrides_must_survive_garbage_collection(bool overrides)
+{
+    if (m_overrides_must_survive_garbage_collection == overrides)
+        return;
+    m_overrides_must_survive_garbage_collection = overrides;
+
+    auto* block = HeapBlockBase::from_cell(this);
+    if (overrides)
+        block->did_add_cell_that_overrides_must_survive_garbage_collection({});
+    else
+        block->did_remove_cell_that_overrides_must_survive_garbage_collection({});
+}
+
 void GC::Cell::Visitor::visit(NanBoxedValue const& value)
 {
     if (value.is_cell())
@@ -42,7 +42,7 @@ class GC_API Cell {
     AK_MAKE_NONMOVABLE(Cell);
 
 public:
-    virtual ~Cell() = default;
+    virtual ~Cell();
 
     bool is_marked() const { return m_mark; }
     void set_marked(bool b) { m_mark = b; }
@@ -185,7 +185,7 @@ protected:
 
     ALWAYS_INLINE void* private_data() const { return bit_cast<HeapBase*>(&heap())->private_data(); }
 
-    void set_overrides_must_survive_garbage_collection(bool b) { m_overrides_must_survive_garbage_collection = b; }
+    void set_overrides_must_survive_garbage_collection(bool);
 
 private:
     bool m_mark { false };
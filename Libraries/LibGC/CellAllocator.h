@@ -27,6 +27,7 @@ public:
     ~CellAllocator() = default;
 
     size_t cell_size() const { return m_cell_size; }
+    char const* class_name() const { return m_class_name; }
 
     Cell* allocate_cell(Heap&);
 
@@ -51,8 +52,6 @@ public:
     using List = IntrusiveList<&CellAllocator::m_list_node>;
 
     BlockAllocator& block_allocator() { return m_block_allocator; }
-    FlatPtr min_block_address() const { return m_min_block_address; }
-    FlatPtr max_block_address() const { return m_max_block_address; }
 
 private:
     char const* const m_class_name { nullptr };
@@ -63,8 +62,6 @@ private:
     using BlockList = IntrusiveList<&HeapBlock::m_list_node>;
     BlockList m_full_blocks;
     BlockList m_usable_blocks;
-    FlatPtr m_min_block_address { explode_byte(0xff) };
-    FlatPtr m_max_block_address { 0 };
 };
 
 template<typename T>
@@ -12,6 +12,8 @@
 #include <AK/JsonArray.h>
 #include <AK/JsonObject.h>
 #include <AK/Platform.h>
+#include <AK/QuickSort.h>
+#include <AK/StringBuilder.h>
 #include <AK/StackInfo.h>
 #include <AK/TemporaryChange.h>
 #include <LibCore/ElapsedTimer.h>
@@ -20,6 +22,7 @@
 #include <LibGC/HeapBlock.h>
 #include <LibGC/NanBoxedValue.h>
 #include <LibGC/Root.h>
+#include <LibThreading/ParallelChunks.h>
 #include <setjmp.h>
 
 #ifdef HAS_ADDRESS_SANITIZER
@@ -60,53 +63,31 @@ void Heap::will_allocate(size_t size)
     m_allocated_bytes_since_last_gc += size;
 }
 
-static void add_possible_value(HashMap<FlatPtr, HeapRoot>& possible_pointers, FlatPtr data, HeapRoot origin, FlatPtr min_block_address, FlatPtr max_block_address)
+static FlatPtr possible_pointer_from_value(FlatPtr data)
 {
     if constexpr (sizeof(FlatPtr*) == sizeof(NanBoxedValue)) {
         // Because NanBoxedValue stores pointers in non-canonical form we have to check if the top bytes
         // match any pointer-backed tag, in that case we have to extract the pointer to its
-        // canonical form and add that as a possible pointer.
-        FlatPtr possible_pointer;
+        // canonical form and use that as the possible pointer.
         if ((data & SHIFTED_IS_CELL_PATTERN) == SHIFTED_IS_CELL_PATTERN)
-            possible_pointer = NanBoxedValue::extract_pointer_bits(data);
-        else
-            possible_pointer = data;
-        if (possible_pointer < min_block_address || possible_pointer > max_block_address)
-            return;
-        possible_pointers.set(possible_pointer, move(origin));
+            return NanBoxedValue::extract_pointer_bits(data);
+        return data;
     } else {
         static_assert((sizeof(NanBoxedValue) % sizeof(FlatPtr*)) == 0);
-        if (data < min_block_address || data > max_block_address)
-            return;
-        // In the 32-bit case we will look at the top and bottom part of NanBoxedValue separately we just
-        // add both the upper and lower bytes as possible pointers.
-        possible_pointers.set(data, move(origin));
-    }
-}
-
-void Heap::find_min_and_max_block_addresses(FlatPtr& min_address, FlatPtr& max_address)
-{
-    min_address = explode_byte(0xff);
-    max_address = 0;
-    for (auto& allocator : m_all_cell_allocators) {
-        min_address = min(min_address, allocator.min_block_address());
-        max_address = max(max_address, allocator.max_block_address() + HeapBlockBase::block_size);
+        // In the 32-bit case we will look at the top and bottom part of NanBoxedValue separately, so
+        // both the upper and lower bytes are treated as possible pointers.
+        return data;
     }
 }
 
-template<typename Callback>
-static void for_each_cell_among_possible_pointers(HashTable<HeapBlock*> const& all_live_heap_blocks, HashMap<FlatPtr, HeapRoot>& possible_pointers, Callback callback)
+void Heap::rebuild_block_index()
 {
-    for (auto possible_pointer : possible_pointers.keys()) {
-        if (!possible_pointer)
-            continue;
-        auto* possible_heap_block = HeapBlock::from_cell(reinterpret_cast<Cell const*>(possible_pointer));
-        if (!all_live_heap_blocks.contains(possible_heap_block))
-            continue;
-        if (auto* cell = possible_heap_block->cell_from_possible_pointer(possible_pointer)) {
-            callback(cell, possible_pointer);
-        }
-    }
+    m_block_index.clear();
+    for_each_block([&](auto& block) {
+        m_block_index.add(block);
+        return IterationDecision::Continue;
+    });
+    m_block_index.sort();
 }
 
 class GraphConstructorVisitor final : public Cell::Visitor {
@@ -114,11 +95,6 @@ public:
     explicit GraphConstructorVisitor(Heap& heap, HashMap<Cell*, HeapRoot> const& roots)
         : m_heap(heap)
     {
-        m_heap.find_min_and_max_block_addresses(m_min_block_address, m_max_block_address);
-        m_heap.for_each_block([&](auto& block) {
-            m_all_live_heap_blocks.set(&block);
-            return IterationDecision::Continue;
-        });
         m_work_queue.ensure_capacity(roots.size());
 
         for (auto& [root, root_origin] : roots) {
@@ -143,20 +119,19 @@ public:
 
     virtual void visit_possible_values(ReadonlyBytes bytes) override
     {
-        HashMap<FlatPtr, HeapRoot> possible_pointers;
-
         auto* raw_pointer_sized_values = reinterpret_cast<FlatPtr const*>(bytes.data());
-        for (size_t i = 0; i < (bytes.size() / sizeof(FlatPtr)); ++i)
-            add_possible_value(possible_pointers, raw_pointer_sized_values[i], HeapRoot { .type = HeapRoot::Type::HeapFunctionCapturedPointer }, m_min_block_address, m_max_block_address);
+        for (size_t i = 0; i < (bytes.size() / sizeof(FlatPtr)); ++i) {
+            auto* cell = m_heap.m_block_index.cell_from_possible_pointer(possible_pointer_from_value(raw_pointer_sized_values[i]));
+            if (!cell)
+                continue;
 
-        for_each_cell_among_possible_pointers(m_all_live_heap_blocks, possible_pointers, [&](Cell* cell, FlatPtr) {
             if (m_node_being_visited)
                 m_node_being_visited->edges.set(reinterpret_cast<FlatPtr>(cell));
 
-            if (m_graph.get(reinterpret_cast<FlatPtr>(&cell)).has_value())
-                return;
+            if (m_graph.get(reinterpret_cast<FlatPtr>(cell)).has_value())
+                continue;
             m_work_queue.append(*cell);
-        });
+        }
     }
 
     void visit_all_cells()
@@ -211,7 +186,117 @@ public:
         return graph;
     }
 
+    // Writes the graph in the .heapsnapshot format understood by Chrome DevTools and other heap analysis tools.
+    // Roots are grouped under one synthetic node per HeapRoot::Type, which hang off the synthetic "(GC roots)" node.
+    void dump_heap_snapshot(StringBuilder& builder)
+    {
+        static constexpr size_t node_field_count = 7;
+        static constexpr size_t node_type_object = 3;
+        static constexpr size_t node_type_synthetic = 9;
+        static constexpr size_t edge_type_element = 1;
+        static constexpr size_t root_type_count = to_underlying(HeapRoot::Type::VM) + 1;
+
+        Vector<StringView> strings;
+        HashMap<StringView, size_t> string_indices;
+        auto string_index = [&](StringView string) {
+            return string_indices.ensure(string, [&] {
+                strings.append(string);
+                return strings.size() - 1;
+            });
+        };
+
+        Array<Vector<FlatPtr>, root_type_count> roots_by_type;
+        HashMap<FlatPtr, size_t> cell_node_indices;
+        size_t next_node_index = 1 + root_type_count;
+        size_t edge_count = 0;
+        for (auto& [address, node] : m_graph) {
+            cell_node_indices.set(address, next_node_index++);
+            if (node.root_origin.has_value())
+                roots_by_type[to_underlying(node.root_origin->type)].append(address);
+            edge_count += node.edges.size();
+        }
+        edge_count += root_type_count;
+        for (auto& roots : roots_by_type)
+            edge_count += roots.size();
+
+        StringBuilder nodes;
+        StringBuilder edges;
+        auto append_node = [&](size_t type, StringView name, size_t node_index, size_t self_size, size_t node_edge_count) {
+            if (!nodes.is_empty())
+                nodes.append(',');
+            nodes.appendff("{},{},{},{},{},0,0", type, string_index(name), node_index + 1, self_size, node_edge_count);
+        };
+        auto append_edge = [&](size_t index, size_t to_node_index) {
+            if (!edges.is_empty())
+                edges.append(',');
+            edges.appendff("{},{},{}", edge_type_element, index, to_node_index * node_field_count);
+        };
+
+        append_node(node_type_synthetic, "(GC roots)"sv, 0, 0, root_type_count);
+        for (size_t i = 0; i < root_type_count; ++i)
+            append_edge(i, 1 + i);
+
+        for (size_t i = 0; i < root_type_count; ++i) {
+            auto& roots = roots_by_type[i];
+            append_node(node_type_synthetic, heap_root_type_name(static_cast<HeapRoot::Type>(i)), 1 + i, 0, roots.size());
+            for (size_t j = 0; j < roots.size(); ++j)
+                append_edge(j, cell_node_indices.get(roots[j]).value());
+        }
+
+        for (auto& [address, node] : m_graph) {
+            auto* cell = bit_cast<Cell*>(address);
+            append_node(node_type_object, node.class_name, cell_node_indices.get(address).value(), HeapBlock::from_cell(cell)->cell_size(), node.edges.size());
+            size_t index = 0;
+            for (auto edge : node.edges)
+                append_edge(index++, cell_node_indices.get(edge).value());
+        }
+
+        builder.append("{\"snapshot\":{\"meta\":{"sv);
+        builder.append("\"node_fields\":[\"type\",\"name\",\"id\",\"self_size\",\"edge_count\",\"trace_node_id\",\"detachedness\"],"sv);
+        builder.append("\"node_types\":[[\"hidden\",\"array\",\"string\",\"object\",\"code\",\"closure\",\"regexp\",\"number\",\"native\",\"synthetic\",\"concatenated string\",\"sliced string\",\"symbol\",\"bigint\",\"object shape\"],\"string\",\"number\",\"number\",\"number\",\"number\",\"number\"],"sv);
+        builder.append("\"edge_fields\":[\"type\",\"name_or_index\",\"to_node\"],"sv);
+        builder.append("\"edge_types\":[[\"context\",\"element\",\"property\",\"internal\",\"hidden\",\"shortcut\",\"weak\"],\"string_or_number\",\"node\"],"sv);
+        builder.append("\"trace_function_info_fields\":[\"function_id\",\"name\",\"script_name\",\"script_id\",\"line\",\"column\"],"sv);
+        builder.append("\"trace_node_fields\":[\"id\",\"function_info_index\",\"count\",\"size\",\"children\"],"sv);
+        builder.append("\"sample_fields\":[\"timestamp_us\",\"last_assigned_id\"],"sv);
+        builder.append("\"location_fields\":[\"object_index\",\"script_id\",\"line\",\"column\"]},"sv);
+        builder.appendff("\"node_count\":{},\"edge_count\":{},\"trace_function_count\":0}},", next_node_index, edge_count);
+        builder.appendff("\"nodes\":[{}],\"edges\":[{}],", nodes.string_view(), edges.string_view());
+        builder.append("\"trace_function_info\":[],\"trace_tree\":[],\"samples\":[],\"locations\":[],\"strings\":["sv);
+        for (size_t i = 0; i < strings.size(); ++i) {
+            if (i != 0)
+                builder.append(',');
+            builder.append('"');
+            builder.append_escaped_for_json(strings[i]);
+            builder.append('"');
+        }
+        builder.append("]}"sv);
+    }
+
 private:
+    static StringView heap_root_type_name(HeapRoot::Type type)
+    {
+        switch (type) {
+        case HeapRoot::Type::HeapFunctionCapturedPointer:
+            return "(HeapFunction captures)"sv;
+        case HeapRoot::Type::Root:
+            return "(Root)"sv;
+        case HeapRoot::Type::RootVector:
+            return "(RootVector)"sv;
+        case HeapRoot::Type::RootHashMap:
+            return "(RootHashMap)"sv;
+        case HeapRoot::Type::ConservativeVector:
+            return "(ConservativeVector)"sv;
+        case HeapRoot::Type::RegisterPointer:
+            return "(Register pointers)"sv;
+        case HeapRoot::Type::StackPointer:
+            return "(Stack pointers)"sv;
+        case HeapRoot::Type::VM:
+            return "(VM)"sv;
+        }
+        VERIFY_NOT_REACHED();
+    }
+
     struct GraphNode {
         Optional<HeapRoot> root_origin;
         StringView class_name;
@@ -223,13 +308,11 @@ private:
     HashMap<FlatPtr, GraphNode> m_graph;
 
     Heap& m_heap;
-    HashTable<HeapBlock*> m_all_live_heap_blocks;
-    FlatPtr m_min_block_address;
-    FlatPtr m_max_block_address;
 };
 
 AK::JsonObject Heap::dump_graph()
 {
+    rebuild_block_index();
     HashMap<Cell*, HeapRoot> roots;
     gather_roots(roots);
     GraphConstructorVisitor visitor(*this, roots);
@@ -237,6 +320,16 @@ AK::JsonObject Heap::dump_graph()
     return visitor.dump();
 }
 
+void Heap::dump_heap_snapshot(StringBuilder& builder)
+{
+    rebuild_block_index();
+    HashMap<Cell*, HeapRoot> roots;
+    gather_roots(roots);
+    GraphConstructorVisitor visitor(*this, roots);
+    visitor.visit_all_cells();
+    visitor.dump_heap_snapshot(builder);
+}
+
 void Heap::collect_garbage(CollectionType collection_type, bool print_report)
 {
     VERIFY(!m_collecting_garbage);
@@ -244,21 +337,51 @@ void Heap::collect_garbage(CollectionType collection_type, bool print_report)
     {
         TemporaryChange change(m_collecting_garbage, true);
 
-        Core::ElapsedTimer collection_measurement_timer;
-        if (print_report)
-            collection_measurement_timer.start();
+        if (collection_type == CollectionType::CollectGarbage && m_gc_deferrals) {
+            m_should_gc_when_deferral_ends = true;
+            return;
+        }
+
+        auto collection_measurement_timer = Core::ElapsedTimer::start_new(Core::TimerType::Precise);
+        auto phase_timer = Core::ElapsedTimer::start_new(Core::TimerType::Precise);
+        auto finish_phase = [&](AK::Duration& phase_time) {
+            phase_time = phase_timer.elapsed_time();
+            phase_timer.start();
+        };
 
+        m_current_collection_phase_timings = {};
         if (collection_type == CollectionType::CollectGarbage) {
-            if (m_gc_deferrals) {
-                m_should_gc_when_deferral_ends = true;
-                return;
-            }
+            rebuild_block_index();
             HashMap<Cell*, HeapRoot> roots;
             gather_roots(roots);
+            finish_phase(m_current_collection_phase_timings.root_gathering);
+            // NOTE: gather_roots() measures conservative scanning on its own, which we report separately.
+            m_current_collection_phase_timings.root_gathering -= m_current_collection_phase_timings.conservative_scanning;
             mark_live_cells(roots);
+            finish_phase(m_current_collection_phase_timings.marking);
         }
         finalize_unmarked_cells();
+        finish_phase(m_current_collection_phase_timings.finalization);
         sweep_dead_cells(print_report, collection_measurement_timer);
+        finish_phase(m_current_collection_phase_timings.sweeping);
+
+        m_last_collection_phase_timings = m_current_collection_phase_timings;
+        m_total_collection_phase_timings += m_current_collection_phase_timings;
+
+        m_last_collection_duration = collection_measurement_timer.elapsed_time();
+        m_pause_histogram.record(m_last_collection_duration);
+        m_recent_pauses.enqueue(m_last_collection_duration);
+        update_gc_bytes_threshold(m_last_collection_duration);
+
+        if (print_report) {
+            dbgln("Pause histogram ({} collections, longest {} ms)", m_pause_histogram.total_count(), m_pause_histogram.longest_pause().to_milliseconds());
+            for (size_t bucket = 0; bucket < PauseHistogram::bucket_count; ++bucket) {
+                if (auto upper_bound = PauseHistogram::bucket_upper_bound_in_milliseconds(bucket); upper_bound.has_value())
+                    dbgln("  < {} ms: {}", *upper_bound, m_pause_histogram.count_in_bucket(bucket));
+                else
+                    dbgln("  >= {} ms: {}", *PauseHistogram::bucket_upper_bound_in_milliseconds(bucket - 1), m_pause_histogram.count_in_bucket(bucket));
+            }
+        }
     }
 
     auto tasks = move(m_post_gc_tasks);
@@ -266,6 +389,185 @@ void Heap::collect_garbage(CollectionType collection_type, bool print_report)
         task();
 }
 
+CollectionPhaseTimings& CollectionPhaseTimings::operator+=(CollectionPhaseTimings const& other)
+{
+    root_gathering += other.root_gathering;
+    conservative_scanning += other.conservative_scanning;
+    marking += other.marking;
+    finalization += other.finalization;
+    sweeping += other.sweeping;
+    return *this;
+}
+
+PauseHistogram Heap::recent_pause_histogram() const
+{
+    PauseHistogram histogram;
+    for (auto pause : m_recent_pauses)
+        histogram.record(pause);
+    return histogram;
+}
+
+Vector<CellAllocatorStatistics> Heap::cell_allocator_statistics()
+{
+    Vector<CellAllocatorStatistics> statistics;
+    for (auto& allocator : m_all_cell_allocators) {
+        CellAllocatorStatistics allocator_statistics;
+        allocator_statistics.class_name = allocator.class_name() ? StringView { allocator.class_name(), strlen(allocator.class_name()) } : StringView {};
+        allocator_statistics.cell_size = allocator.cell_size();
+        allocator.for_each_block([&](auto& block) {
+            ++allocator_statistics.block_count;
+            allocator_statistics.capacity_bytes += block.cell_count() * block.cell_size();
+            block.template for_each_cell_in_state<Cell::State::Live>([&](Cell*) {
+                ++allocator_statistics.live_cell_count;
+            });
+            return IterationDecision::Continue;
+        });
+        allocator_statistics.live_bytes = allocator_statistics.live_cell_count * allocator_statistics.cell_size;
+        statistics.append(allocator_statistics);
+    }
+    return statistics;
+}
+
+static double duration_in_milliseconds(AK::Duration duration)
+{
+    return static_cast<double>(duration.to_nanoseconds()) / 1'000'000.0;
+}
+
+static AK::JsonObject serialize_phase_timings(CollectionPhaseTimings const& timings)
+{
+    AK::JsonObject object;
+    object.set("root_gathering_ms"sv, duration_in_milliseconds(timings.root_gathering));
+    object.set("conservative_scanning_ms"sv, duration_in_milliseconds(timings.conservative_scanning));
+    object.set("marking_ms"sv, duration_in_milliseconds(timings.marking));
+    object.set("finalization_ms"sv, duration_in_milliseconds(timings.finalization));
+    object.set("sweeping_ms"sv, duration_in_milliseconds(timings.sweeping));
+    return object;
+}
+
+AK::JsonObject Heap::statistics_summary() const
+{
+    AK::JsonObject object;
+    object.set("collection_count"sv, collection_count());
+    object.set("last_collection_ms"sv, duration_in_milliseconds(m_last_collection_duration));
+    object.set("gc_bytes_threshold"sv, m_gc_bytes_threshold);
+    object.set("allocated_bytes_since_last_gc"sv, m_allocated_bytes_since_last_gc);
+    object.set("live_bytes_after_last_gc"sv, m_live_cell_bytes_after_last_gc);
+    object.set("heap_growth_factor"sv, m_heap_growth_factor);
+    return object;
+}
+
+AK::JsonObject Heap::statistics()
+{
+    auto object = statistics_summary();
+    object.set("last_collection_phases"sv, serialize_phase_timings(m_last_collection_phase_timings));
+    object.set("total_collection_phases"sv, serialize_phase_timings(m_total_collection_phase_timings));
+
+    auto recent_pauses = recent_pause_histogram();
+    AK::JsonArray pause_histogram;
+    for (size_t bucket = 0; bucket < PauseHistogram::bucket_count; ++bucket) {
+        AK::JsonObject bucket_object;
+        if (auto upper_bound = PauseHistogram::bucket_upper_bound_in_milliseconds(bucket); upper_bound.has_value())
+            bucket_object.set("upper_bound_ms"sv, *upper_bound);
+        else
+            bucket_object.set("upper_bound_ms"sv, AK::JsonValue {});
+        bucket_object.set("count"sv, recent_pauses.count_in_bucket(bucket));
+        pause_histogram.must_append(move(bucket_object));
+    }
+    object.set("recent_pause_histogram"sv, move(pause_histogram));
+    object.set("recent_longest_pause_ms"sv, duration_in_milliseconds(recent_pauses.longest_pause()));
+
+    AK::JsonArray allocators;
+    for (auto const& allocator_statistics : cell_allocator_statistics()) {
+        AK::JsonObject allocator_object;
+        if (allocator_statistics.class_name.is_null())
+            allocator_object.set("name"sv, MUST(String::formatted("size-{}", allocator_statistics.cell_size)));
+        else
+            allocator_object.set("name"sv, allocator_statistics.class_name);
+        allocator_object.set("cell_size"sv, allocator_statistics.cell_size);
+        allocator_object.set("block_count"sv, allocator_statistics.block_count);
+        allocator_object.set("live_cell_count"sv, allocator_statistics.live_cell_count);
+        allocator_object.set("live_bytes"sv, allocator_statistics.live_bytes);
+        allocator_object.set("capacity_bytes"sv, allocator_statistics.capacity_bytes);
+        auto fragmentation = allocator_statistics.capacity_bytes == 0 ? 0.0 : 1.0 - static_cast<double>(allocator_statistics.live_bytes) / static_cast<double>(allocator_statistics.capacity_bytes);
+        allocator_object.set("fragmentation"sv, fragmentation);
+        allocators.must_append(move(allocator_object));
+    }
+    object.set("allocators"sv, move(allocators));
+
+    return object;
+}
+
+void Heap::update_gc_bytes_threshold(AK::Duration collection_duration)
+{
+    auto now = MonotonicTime::now();
+    auto time_between_collections = now - m_last_collection_end_time;
+    m_last_collection_end_time = now;
+
+    // NOTE: The time between the end of two collections covers both the mutator running and the collection itself, so
+    //       this measures how much of the program's time went to GC. A high allocation rate or an expensive live set
+    //       both drive it up, and we respond by letting the heap grow more before the next collection.
+    auto total_nanoseconds = time_between_collections.to_nanoseconds();
+    if (total_nanoseconds > 0) {
+        auto gc_overhead = static_cast<double>(collection_duration.to_nanoseconds()) / static_cast<double>(total_nanoseconds);
+        if (gc_overhead > m_target_gc_overhead)
+            m_heap_growth_factor = min(m_heap_growth_factor * 1.5, MAX_HEAP_GROWTH_FACTOR);
+        else if (gc_overhead < m_target_gc_overhead / 2)
+            m_heap_growth_factor = max(m_heap_growth_factor * 0.8, MIN_HEAP_GROWTH_FACTOR);
+    }
+
+    auto growth_factor = m_heap_growth_factor;
+    switch (m_memory_pressure) {
+    case MemoryPressure::None:
+        break;
+    case MemoryPressure::Moderate:
+        growth_factor = min(growth_factor, 1.0);
+        break;
+    case MemoryPressure::Critical:
+        growth_factor = MIN_HEAP_GROWTH_FACTOR;
+        break;
+    }
+
+    auto threshold = static_cast<size_t>(static_cast<double>(m_live_cell_bytes_after_last_gc) * growth_factor);
+    m_gc_bytes_threshold = max(threshold, GC_MIN_BYTES_THRESHOLD);
+}
+
+void Heap::set_memory_pressure(MemoryPressure memory_pressure)
+{
+    m_memory_pressure = memory_pressure;
+    if (memory_pressure != MemoryPressure::Critical || m_collecting_garbage)
+        return;
+
+    m_allocated_bytes_since_last_gc = 0;
+    collect_garbage();
+    release_free_blocks();
+}
+
+void Heap::release_free_blocks()
+{
+    for (auto& allocator : m_all_cell_allocators)
+        allocator.block_allocator().decommit_pending_blocks();
+}
+
+bool Heap::collect_garbage_if_idle_time_allows(AK::Duration available_time)
+{
+    if (m_collecting_garbage || m_gc_deferrals)
+        return false;
+
+    // NOTE: Collecting right after the previous collection would mostly rediscover the same live set, so wait
+    //       until most of the allocation threshold has been used up. Every idle collection starts a new threshold
+    //       period, so collecting any earlier would noticeably increase how often we collect on pages with idle time.
+    if (static_cast<double>(m_allocated_bytes_since_last_gc) < static_cast<double>(m_gc_bytes_threshold) * IDLE_GC_MIN_THRESHOLD_FRACTION)
+        return false;
+
+    // NOTE: The previous pause is our best predictor of the next one, since the live set changes slowly.
+    if (m_last_collection_duration > available_time)
+        return false;
+
+    m_allocated_bytes_since_last_gc = 0;
+    collect_garbage();
+    return true;
+}
+
 void Heap::enqueue_post_gc_task(AK::Function<void()> task)
 {
     m_post_gc_tasks.append(move(task));
@@ -274,7 +576,10 @@ void Heap::enqueue_post_gc_task(AK::Function<void()> task)
 void Heap::gather_roots(HashMap<Cell*, HeapRoot>& roots)
 {
     m_gather_embedder_roots(roots);
+
+    auto conservative_scanning_timer = Core::ElapsedTimer::start_new(Core::TimerType::Precise);
     gather_conservative_roots(roots);
+    m_current_collection_phase_timings.conservative_scanning = conservative_scanning_timer.elapsed_time();
 
     for (auto& root : m_roots)
         roots.set(root.cell(), HeapRoot { .type = HeapRoot::Type::Root, .location = &root.source_location() });
@@ -292,8 +597,21 @@ void Heap::gather_roots(HashMap<Cell*, HeapRoot>& roots)
     }
 }
 
+void Heap::add_possible_root(HashMap<Cell*, HeapRoot>& roots, FlatPtr data, HeapRoot origin)
+{
+    auto* cell = m_block_index.cell_from_possible_pointer(possible_pointer_from_value(data));
+    if (!cell)
+        return;
+    if (cell->state() == Cell::State::Live) {
+        dbgln_if(HEAP_DEBUG, "  ?-> {}", (void const*)cell);
+        roots.set(cell, origin);
+    } else {
+        dbgln_if(HEAP_DEBUG, "  #-> {}", (void const*)cell);
+    }
+}
+
 #ifdef HAS_ADDRESS_SANITIZER
-NO_SANITIZE_ADDRESS void Heap::gather_asan_fake_stack_roots(HashMap<FlatPtr, HeapRoot>& possible_pointers, FlatPtr addr, FlatPtr min_block_address, FlatPtr max_block_address)
+NO_SANITIZE_ADDRESS void Heap::gather_asan_fake_stack_roots(HashMap<Cell*, HeapRoot>& roots, FlatPtr addr)
 {
     void* begin = nullptr;
     void* end = nullptr;
@@ -304,12 +622,12 @@ NO_SANITIZE_ADDRESS void Heap::gather_asan_fake_stack_roots(HashMap<FlatPtr, Hea
             void const* real_address = *real_stack_addr;
             if (real_address == nullptr)
                 continue;
-            add_possible_value(possible_pointers, reinterpret_cast<FlatPtr>(real_address), HeapRoot { .type = HeapRoot::Type::StackPointer }, min_block_address, max_block_address);
+            add_possible_root(roots, reinterpret_cast<FlatPtr>(real_address), HeapRoot { .type = HeapRoot::Type::StackPointer });
         }
     }
 }
 #else
-void Heap::gather_asan_fake_stack_roots(HashMap<FlatPtr, HeapRoot>&, FlatPtr, FlatPtr, FlatPtr)
+void Heap::gather_asan_fake_stack_roots(HashMap<Cell*, HeapRoot>&, FlatPtr)
 {
 }
 #endif
@@ -323,44 +641,43 @@ NO_SANITIZE_ADDRESS void Heap::gather_conservative_roots(HashMap<Cell*, HeapRoot
     jmp_buf buf;
     setjmp(buf);
 
-    HashMap<FlatPtr, HeapRoot> possible_pointers;
-
     auto* raw_jmp_buf = reinterpret_cast<FlatPtr const*>(buf);
 
-    FlatPtr min_block_address, max_block_address;
-    find_min_and_max_block_addresses(min_block_address, max_block_address);
-
     for (size_t i = 0; i < ((size_t)sizeof(buf)) / sizeof(FlatPtr); ++i)
-        add_possible_value(possible_pointers, raw_jmp_buf[i], HeapRoot { .type = HeapRoot::Type::RegisterPointer }, min_block_address, max_block_address);
+        add_possible_root(roots, raw_jmp_buf[i], HeapRoot { .type = HeapRoot::Type::RegisterPointer });
+
+    // NOTE: The embedder reports the contents of these ranges precisely, so there is no need to scan them.
+    m_precisely_scanned_ranges.clear_with_capacity();
+    if (m_gather_precisely_scanned_ranges)
+        m_gather_precisely_scanned_ranges(m_precisely_scanned_ranges);
+    quick_sort(m_precisely_scanned_ranges, [](auto& a, auto& b) { return a.data() < b.data(); });
+    size_t next_precise_range_index = 0;
 
     auto stack_reference = bit_cast<FlatPtr>(&dummy);
 
     for (FlatPtr stack_address = stack_reference; stack_address < m_stack_info.top(); stack_address += sizeof(FlatPtr)) {
+        while (next_precise_range_index < m_precisely_scanned_ranges.size() && bit_cast<FlatPtr>(m_precisely_scanned_ranges[next_precise_range_index].data() + m_precisely_scanned_ranges[next_precise_range_index].size()) <= stack_address)
+            ++next_precise_range_index;
+        if (next_precise_range_index < m_precisely_scanned_ranges.size()) {
+            auto range = m_precisely_scanned_ranges[next_precise_range_index];
+            auto range_start = bit_cast<FlatPtr>(range.data());
+            if (stack_address >= range_start) {
+                // Continue with the first pointer-aligned word at or after the end of the range.
+                stack_address = align_up_to(range_start + range.size(), sizeof(FlatPtr)) - sizeof(FlatPtr);
+                continue;
+            }
+        }
+
         auto data = *reinterpret_cast<FlatPtr*>(stack_address);
-        add_possible_value(possible_pointers, data, HeapRoot { .type = HeapRoot::Type::StackPointer }, min_block_address, max_block_address);
-        gather_asan_fake_stack_roots(possible_pointers, data, min_block_address, max_block_address);
+        add_possible_root(roots, data, HeapRoot { .type = HeapRoot::Type::StackPointer });
+        gather_asan_fake_stack_roots(roots, data);
     }
 
     for (auto& vector : m_conservative_vectors) {
         for (auto possible_value : vector.possible_values()) {
-            add_possible_value(possible_pointers, possible_value, HeapRoot { .type = HeapRoot::Type::ConservativeVector }, min_block_address, max_block_address);
+            add_possible_root(roots, possible_value, HeapRoot { .type = HeapRoot::Type::ConservativeVector });
         }
     }
-
-    HashTable<HeapBlock*> all_live_heap_blocks;
-    for_each_block([&](auto& block) {
-        all_live_heap_blocks.set(&block);
-        return IterationDecision::Continue;
-    });
-
-    for_each_cell_among_possible_pointers(all_live_heap_blocks, possible_pointers, [&](Cell* cell, FlatPtr possible_pointer) {
-        if (cell->state() == Cell::State::Live) {
-            dbgln_if(HEAP_DEBUG, "  ?-> {}", (void const*)cell);
-            roots.set(cell, *possible_pointers.get(possible_pointer));
-        } else {
-            dbgln_if(HEAP_DEBUG, "  #-> {}", (void const*)cell);
-        }
-    });
 }
 
 class MarkingVisitor final : public Cell::Visitor {
@@ -368,12 +685,6 @@ public:
     explicit MarkingVisitor(Heap& heap, HashMap<Cell*, HeapRoot> const& roots)
         : m_heap(heap)
     {
-        m_heap.find_min_and_max_block_addresses(m_min_block_address, m_max_block_address);
-        m_heap.for_each_block([&](auto& block) {
-            m_all_live_heap_blocks.set(&block);
-            return IterationDecision::Continue;
-        });
-
         for (auto* root : roots.keys()) {
             visit(root);
         }
@@ -391,20 +702,16 @@ public:
 
     virtual void visit_possible_values(ReadonlyBytes bytes) override
     {
-        HashMap<FlatPtr, HeapRoot> possible_pointers;
-
         auto* raw_pointer_sized_values = reinterpret_cast<FlatPtr const*>(bytes.data());
-        for (size_t i = 0; i < (bytes.size() / sizeof(FlatPtr)); ++i)
-            add_possible_value(possible_pointers, raw_pointer_sized_values[i], HeapRoot { .type = HeapRoot::Type::HeapFunctionCapturedPointer }, m_min_block_address, m_max_block_address);
-
-        for_each_cell_among_possible_pointers(m_all_live_heap_blocks, possible_pointers, [&](Cell* cell, FlatPtr) {
-            if (cell->is_marked())
-                return;
+        for (size_t i = 0; i < (bytes.size() / sizeof(FlatPtr)); ++i) {
+            auto* cell = m_heap.m_block_index.cell_from_possible_pointer(possible_pointer_from_value(raw_pointer_sized_values[i]));
+            if (!cell || cell->is_marked())
+                continue;
             if (cell->state() != Cell::State::Live)
-                return;
+                continue;
             cell->set_marked(true);
             m_work_queue.append(*cell);
-        });
+        }
     }
 
     void mark_all_live_cells()
@@ -417,9 +724,6 @@ public:
 private:
     Heap& m_heap;
     Vector<Ref<Cell>> m_work_queue;
-    HashTable<HeapBlock*> m_all_live_heap_blocks;
-    FlatPtr m_min_block_address;
-    FlatPtr m_max_block_address;
 };
 
 void Heap::mark_live_cells(HashMap<Cell*, HeapRoot> const& roots)
@@ -434,6 +738,8 @@ void Heap::mark_live_cells(HashMap<Cell*, HeapRoot> const& roots)
         inverse_root->set_marked(false);
 
     for_each_block([&](auto& block) {
+        if (!block.has_cells_that_override_must_survive_garbage_collection())
+            return IterationDecision::Continue;
         block.template for_each_cell_in_state<Cell::State::Live>([&](Cell* cell) {
             if (!cell->is_marked() && cell_must_survive_garbage_collection(*cell))
                 cell->visit_edges(visitor);
@@ -473,28 +779,39 @@ void Heap::sweep_dead_cells(bool print_report, Core::ElapsedTimer const& measure
     size_t collected_cell_bytes = 0;
     size_t live_cell_bytes = 0;
 
+    Vector<HeapBlock*> blocks;
     for_each_block([&](auto& block) {
+        blocks.append(&block);
+        return IterationDecision::Continue;
+    });
+
+    // OPTIMIZATION: Most blocks in a large heap contain only surviving cells, and all sweeping has to do for them
+    //               is clear mark bits. That part touches nothing but the block itself, so we spread it across
+    //               worker threads. Blocks with dead cells are left for the main thread, since cell destructors
+    //               may touch state that is not thread-safe.
+    auto blocks_with_dead_cells = clear_marks_in_fully_marked_blocks(blocks, live_cells, live_cell_bytes);
+
+    for (auto* block : blocks_with_dead_cells) {
         bool block_has_live_cells = false;
-        bool block_was_full = block.is_full();
-        block.template for_each_cell_in_state<Cell::State::Live>([&](Cell* cell) {
+        bool block_was_full = block->is_full();
+        block->for_each_cell_in_state<Cell::State::Live>([&](Cell* cell) {
             if (!cell->is_marked()) {
                 dbgln_if(HEAP_DEBUG, "  ~ {}", cell);
-                block.deallocate(cell);
+                block->deallocate(cell);
                 ++collected_cells;
-                collected_cell_bytes += block.cell_size();
+                collected_cell_bytes += block->cell_size();
             } else {
                 cell->set_marked(false);
                 block_has_live_cells = true;
                 ++live_cells;
-                live_cell_bytes += block.cell_size();
+                live_cell_bytes += block->cell_size();
             }
         });
         if (!block_has_live_cells)
-            empty_blocks.append(&block);
-        else if (block_was_full != block.is_full())
-            full_blocks_that_became_usable.append(&block);
-        return IterationDecision::Continue;
-    });
+            empty_blocks.append(block);
+        else if (block_was_full != block->is_full())
+            full_blocks_that_became_usable.append(block);
+    }
 
     for (auto& weak_container : m_weak_containers)
         weak_container.remove_dead_cells({});
@@ -516,7 +833,7 @@ void Heap::sweep_dead_cells(bool print_report, Core::ElapsedTimer const& measure
         });
     }
 
-    m_gc_bytes_threshold = live_cell_bytes > GC_MIN_BYTES_THRESHOLD ? live_cell_bytes : GC_MIN_BYTES_THRESHOLD;
+    m_live_cell_bytes_after_last_gc = live_cell_bytes;
 
     if (print_report) {
         AK::Duration const time_spent = measurement_timer.elapsed_time();
@@ -537,6 +854,57 @@ void Heap::sweep_dead_cells(bool print_report, Core::ElapsedTimer const& measure
     }
 }
 
+Vector<HeapBlock*> Heap::clear_marks_in_fully_marked_blocks(Vector<HeapBlock*> const& blocks, size_t& live_cells, size_t& live_cell_bytes)
+{
+    struct Chunk {
+        Span<HeapBlock* const> blocks;
+        Vector<HeapBlock*> blocks_with_dead_cells;
+        size_t live_cells { 0 };
+        size_t live_cell_bytes { 0 };
+    };
+
+    auto process_chunk = [](Chunk& chunk) {
+        for (auto* block : chunk.blocks) {
+            size_t live_cells_in_block = 0;
+            bool has_dead_cells = false;
+            block->for_each_cell_in_state<Cell::State::Live>([&](Cell* cell) {
+                if (!cell->is_marked())
+                    has_dead_cells = true;
+                ++live_cells_in_block;
+            });
+            // NOTE: Blocks without any live cells need to be returned to their allocator, which only the main thread may do.
+            if (has_dead_cells || live_cells_in_block == 0) {
+                chunk.blocks_with_dead_cells.append(block);
+                continue;
+            }
+            block->for_each_cell_in_state<Cell::State::Live>([](Cell* cell) {
+                cell->set_marked(false);
+            });
+            chunk.live_cells += live_cells_in_block;
+            chunk.live_cell_bytes += live_cells_in_block * block->cell_size();
+        }
+    };
+
+    // NOTE: Handing work to other threads is not free, so only bother for heaps where sweeping takes a noticeable amount of time.
+    static constexpr size_t min_blocks_per_chunk = 1024;
+
+    Vector<Chunk> chunks;
+    chunks.resize(Threading::parallel_chunk_count(blocks.size(), min_blocks_per_chunk));
+    Threading::for_each_chunk_in_parallel(blocks.size(), chunks.size(), [&](size_t chunk_index, size_t start, size_t end) {
+        auto& chunk = chunks[chunk_index];
+        chunk.blocks = blocks.span().slice(start, end - start);
+        process_chunk(chunk);
+    });
+
+    Vector<HeapBlock*> blocks_with_dead_cells;
+    for (auto& chunk : chunks) {
+        blocks_with_dead_cells.extend(move(chunk.blocks_with_dead_cells));
+        live_cells += chunk.live_cells;
+        live_cell_bytes += chunk.live_cell_bytes;
+    }
+    return blocks_with_dead_cells;
+}
+
 void Heap::defer_gc()
 {
     ++m_gc_deferrals;
@@ -7,6 +7,7 @@
 #pragma once
 
 #include <AK/Badge.h>
+#include <AK/CircularQueue.h>
 #include <AK/Function.h>
 #include <AK/IntrusiveList.h>
 #include <AK/Noncopyable.h>
@@ -20,8 +21,11 @@
 #include <LibGC/CellAllocator.h>
 #include <LibGC/ConservativeVector.h>
 #include <LibGC/Forward.h>
+#include <LibGC/HeapBlockIndex.h>
 #include <LibGC/HeapRoot.h>
 #include <LibGC/Internals.h>
+#include <LibGC/MemoryPressure.h>
+#include <LibGC/PauseHistogram.h>
 #include <LibGC/Root.h>
 #include <LibGC/RootHashMap.h>
 #include <LibGC/RootVector.h>
@@ -29,6 +33,25 @@
 
 namespace GC {
 
+struct CollectionPhaseTimings {
+    AK::Duration root_gathering;
+    AK::Duration conservative_scanning;
+    AK::Duration marking;
+    AK::Duration finalization;
+    AK::Duration sweeping;
+
+    CollectionPhaseTimings& operator+=(CollectionPhaseTimings const&);
+};
+
+struct CellAllocatorStatistics {
+    StringView class_name;
+    size_t cell_size { 0 };
+    size_t block_count { 0 };
+    size_t live_cell_count { 0 };
+    size_t live_bytes { 0 };
+    size_t capacity_bytes { 0 };
+};
+
 class GC_API Heap : public HeapBase {
     AK_MAKE_NONCOPYABLE(Heap);
     AK_MAKE_NONMOVABLE(Heap);
@@ -53,7 +76,45 @@ public:
     };
 
     void collect_garbage(CollectionType = CollectionType::CollectGarbage, bool print_report = false);
+
+    // Collects garbage ahead of the allocation threshold if a collection is worthwhile and the previous one
+    // fit within the given time. Returns true if a collection was performed.
+    bool collect_garbage_if_idle_time_allows(AK::Duration available_time);
+
+    // An idle collection is only worthwhile once at least this fraction of the allocation threshold has been used up.
+    static constexpr double IDLE_GC_MIN_THRESHOLD_FRACTION { 0.75 };
+
+    size_t gc_bytes_threshold() const { return m_gc_bytes_threshold; }
+    size_t allocated_bytes_since_last_gc() const { return m_allocated_bytes_since_last_gc; }
+    size_t live_cell_bytes_after_last_gc() const { return m_live_cell_bytes_after_last_gc; }
+
+    // Lets the embedder relay system memory pressure. Under pressure the heap is allowed to grow less between
+    // collections, and critical pressure triggers an immediate collection.
+    void set_memory_pressure(MemoryPressure);
+    MemoryPressure memory_pressure() const { return m_memory_pressure; }
+
+    // The fraction of wall time we aim to spend collecting garbage. The heap is allowed to grow faster between
+    // collections when we spend more than this, and slower when we spend much less.
+    void set_target_gc_overhead(double target) { m_target_gc_overhead = target; }
+    double heap_growth_factor() const { return m_heap_growth_factor; }
+
+    static constexpr double MIN_HEAP_GROWTH_FACTOR { 0.5 };
+    static constexpr double MAX_HEAP_GROWTH_FACTOR { 4.0 };
+
+    PauseHistogram const& pause_histogram() const { return m_pause_histogram; }
+    PauseHistogram recent_pause_histogram() const;
+    AK::Duration last_collection_duration() const { return m_last_collection_duration; }
+
+    size_t collection_count() const { return m_pause_histogram.total_count(); }
+    CollectionPhaseTimings const& last_collection_phase_timings() const { return m_last_collection_phase_timings; }
+    CollectionPhaseTimings const& total_collection_phase_timings() const { return m_total_collection_phase_timings; }
+    Vector<CellAllocatorStatistics> cell_allocator_statistics();
+
+    // A subset of statistics() that doesn't walk the heap, cheap enough to poll.
+    AK::JsonObject statistics_summary() const;
+    AK::JsonObject statistics();
     AK::JsonObject dump_graph();
+    void dump_heap_snapshot(StringBuilder&);
 
     bool should_collect_on_every_allocation() const { return m_should_collect_on_every_allocation; }
     void set_should_collect_on_every_allocation(bool b) { m_should_collect_on_every_allocation = b; }
@@ -81,6 +142,10 @@ public:
 
     void enqueue_post_gc_task(AK::Function<void()>);
 
+    // Lets the embedder name memory ranges whose cell pointers it reports precisely through its root gathering
+    // callback. Conservative stack scanning skips any of these ranges that live on the stack.
+    void set_gather_precisely_scanned_ranges(AK::Function<void(Vector<ReadonlyBytes>&)> callback) { m_gather_precisely_scanned_ranges = move(callback); }
+
 private:
     friend class MarkingVisitor;
     friend class GraphConstructorVisitor;
@@ -106,13 +171,17 @@ private:
 
     void will_allocate(size_t);
 
-    void find_min_and_max_block_addresses(FlatPtr& min_address, FlatPtr& max_address);
+    void rebuild_block_index();
     void gather_roots(HashMap<Cell*, HeapRoot>&);
     void gather_conservative_roots(HashMap<Cell*, HeapRoot>&);
-    void gather_asan_fake_stack_roots(HashMap<FlatPtr, HeapRoot>&, FlatPtr, FlatPtr min_block_address, FlatPtr max_block_address);
+    void gather_asan_fake_stack_roots(HashMap<Cell*, HeapRoot>&, FlatPtr);
+    void add_possible_root(HashMap<Cell*, HeapRoot>&, FlatPtr data, HeapRoot origin);
     void mark_live_cells(HashMap<Cell*, HeapRoot> const& live_cells);
     void finalize_unmarked_cells();
     void sweep_dead_cells(bool print_report, Core::ElapsedTimer const&);
+    void update_gc_bytes_threshold(AK::Duration collection_duration);
+    void release_free_blocks();
+    Vector<HeapBlock*> clear_marks_in_fully_marked_blocks(Vector<HeapBlock*> const& blocks, size_t& live_cells, size_t& live_cell_bytes);
 
     ALWAYS_INLINE CellAllocator& allocator_for_size(size_t cell_size)
     {
@@ -137,6 +206,12 @@ private:
     static constexpr size_t GC_MIN_BYTES_THRESHOLD { 4 * 1024 * 1024 };
     size_t m_gc_bytes_threshold { GC_MIN_BYTES_THRESHOLD };
     size_t m_allocated_bytes_since_last_gc { 0 };
+    size_t m_live_cell_bytes_after_last_gc { 0 };
+
+    double m_heap_growth_factor { 1.0 };
+    double m_target_gc_overhead { 0.05 };
+    MonotonicTime m_last_collection_end_time { MonotonicTime::now() };
+    MemoryPressure m_memory_pressure { MemoryPressure::None };
 
     bool m_should_collect_on_every_allocation { false };
 
@@ -155,8 +230,22 @@ private:
     bool m_should_gc_when_deferral_ends { false };
 
     bool m_collecting_garbage { false };
+
+    PauseHistogram m_pause_histogram;
+    static constexpr size_t RECENT_PAUSE_COUNT { 128 };
+    CircularQueue<AK::Duration, RECENT_PAUSE_COUNT> m_recent_pauses;
+    AK::Duration m_last_collection_duration;
+
+    CollectionPhaseTimings m_current_collection_phase_timings;
+    CollectionPhaseTimings m_last_collection_phase_timings;
+    CollectionPhaseTimings m_total_collection_phase_timings;
+
     StackInfo m_stack_info;
     AK::Function<void(HashMap<Cell*, GC::HeapRoot>&)> m_gather_embedder_roots;
+    AK::Function<void(Vector<ReadonlyBytes>&)> m_gather_precisely_scanned_ranges;
+    Vector<ReadonlyBytes> m_precisely_scanned_ranges;
+
+    HeapBlockIndex m_block_index;
 
     Vector<AK::Function<void()>> m_post_gc_tasks;
 } SWIFT_IMMORTAL_REFERENCE;
@@ -0,0 +1,49 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/BinarySearch.h>
+#include <AK/QuickSort.h>
+#include <AK/Vector.h>
+#include <LibGC/HeapBlock.h>
+
+namespace GC {
+
+// A sorted list of the addresses of all live HeapBlocks. Used to resolve conservatively found values to cells
+// with a range check and a binary search, instead of hashing every candidate.
+class HeapBlockIndex {
+public:
+    void clear() { m_block_addresses.clear_with_capacity(); }
+    void add(HeapBlock& block) { m_block_addresses.append(bit_cast<FlatPtr>(&block)); }
+    void sort() { quick_sort(m_block_addresses); }
+
+    size_t size() const { return m_block_addresses.size(); }
+
+    HeapBlock* block_from_possible_pointer(FlatPtr pointer) const
+    {
+        if (m_block_addresses.is_empty())
+            return nullptr;
+        if (pointer < m_block_addresses.first() || pointer >= m_block_addresses.last() + HeapBlock::block_size)
+            return nullptr;
+        auto block_address = pointer & ~(HeapBlock::block_size - 1);
+        if (!binary_search(m_block_addresses, block_address))
+            return nullptr;
+        return bit_cast<HeapBlock*>(block_address);
+    }
+
+    Cell* cell_from_possible_pointer(FlatPtr pointer) const
+    {
+        if (auto* block = block_from_possible_pointer(pointer))
+            return block->cell_from_possible_pointer(pointer);
+        return nullptr;
+    }
+
+private:
+    Vector<FlatPtr> m_block_addresses;
+};
+
+}
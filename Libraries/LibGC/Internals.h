@@ -7,6 +7,7 @@
 
 #pragma once
 
+#include <AK/Badge.h>
 #include <AK/Types.h>
 #include <LibGC/Export.h>
 #include <LibGC/Forward.h>
@@ -42,6 +43,10 @@ public:
 
     Heap& heap() { return m_heap; }
 
+    bool has_cells_that_override_must_survive_garbage_collection() const { return m_must_survive_cell_count > 0; }
+    void did_add_cell_that_overrides_must_survive_garbage_collection(Badge<Cell>) { ++m_must_survive_cell_count; }
+    void did_remove_cell_that_overrides_must_survive_garbage_collection(Badge<Cell>) { --m_must_survive_cell_count; }
+
 protected:
     HeapBlockBase(Heap& heap)
         : m_heap(heap)
@@ -49,6 +54,10 @@ protected:
     }
 
     Heap& m_heap;
+
+    // NOTE: Very few cells ever ask to survive garbage collection, so we keep count of them per block to avoid walking
+    //       every cell in the heap looking for them on each collection.
+    size_t m_must_survive_cell_count { 0 };
 };
 
 }
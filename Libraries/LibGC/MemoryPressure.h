@@ -0,0 +1,19 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/Types.h>
+
+namespace GC {
+
+enum class MemoryPressure : u8 {
+    None,
+    Moderate,
+    Critical,
+};
+
+}
@@ -0,0 +1,56 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/Array.h>
+#include <AK/Optional.h>
+#include <AK/Time.h>
+#include <AK/Types.h>
+
+namespace GC {
+
+// Counts garbage collection pauses in power-of-two millisecond buckets: <1ms, <2ms, <4ms, ..., <128ms, and >=128ms.
+class PauseHistogram {
+public:
+    static constexpr size_t bucket_count = 9;
+
+    void record(AK::Duration pause)
+    {
+        auto milliseconds = pause.to_milliseconds();
+        size_t bucket = 0;
+        while (bucket < bucket_count - 1 && milliseconds >= (1ll << bucket))
+            ++bucket;
+        ++m_buckets[bucket];
+        ++m_total_count;
+        m_total_time += pause;
+        if (pause > m_longest_pause)
+            m_longest_pause = pause;
+    }
+
+    // Exclusive upper bound of the bucket in milliseconds, or none for the overflow bucket.
+    static Optional<i64> bucket_upper_bound_in_milliseconds(size_t bucket)
+    {
+        if (bucket >= bucket_count - 1)
+            return {};
+        return 1ll << bucket;
+    }
+
+    size_t count_in_bucket(size_t bucket) const { return m_buckets[bucket]; }
+    size_t total_count() const { return m_total_count; }
+    AK::Duration total_time() const { return m_total_time; }
+    AK::Duration longest_pause() const { return m_longest_pause; }
+
+    void clear() { *this = {}; }
+
+private:
+    Array<size_t, bucket_count> m_buckets {};
+    size_t m_total_count { 0 };
+    AK::Duration m_total_time;
+    AK::Duration m_longest_pause;
+};
+
+}
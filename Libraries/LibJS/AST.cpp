@@ -453,7 +453,7 @@ ThrowCompletionOr<ECMAScriptFunctionObject*> ClassExpression::create_class_const
             }));
     }
 
-    class_constructor->set_source_text(source_text());
+    class_constructor->set_source_text(m_source_text_range);
 
     return { class_constructor };
 }
@@ -835,9 +835,9 @@ void BindingPattern::dump(int indent) const
     }
 }
 
-FunctionNode::FunctionNode(RefPtr<Identifier const> name, ByteString source_text, NonnullRefPtr<Statement const> body, NonnullRefPtr<FunctionParameters const> parameters, i32 function_length, FunctionKind kind, bool is_strict_mode, FunctionParsingInsights parsing_insights, bool is_arrow_function, Vector<LocalVariable> local_variables_names)
+FunctionNode::FunctionNode(RefPtr<Identifier const> name, UnrealizedSourceRange source_text_range, NonnullRefPtr<Statement const> body, NonnullRefPtr<FunctionParameters const> parameters, i32 function_length, FunctionKind kind, bool is_strict_mode, FunctionParsingInsights parsing_insights, bool is_arrow_function, Vector<LocalVariable> local_variables_names)
     : m_name(move(name))
-    , m_source_text(move(source_text))
+    , m_source_text_range(move(source_text_range))
     , m_body(move(body))
     , m_parameters(move(parameters))
     , m_function_length(function_length)
@@ -1766,8 +1766,9 @@ Bytecode::CodeGenerationErrorOr<Optional<ScopedOperand>> CallExpression::generat
     // NOTE: If the callee/this value isn't already a temporary, we copy them to new registers
     //       to avoid overwriting them while evaluating arguments.
     // Example: foo.bar(Object.getPrototypeOf(foo).bar = null, foo = null)
-    auto this_value = generator.copy_if_needed_to_preserve_evaluation_order(original_this_value);
-    auto callee = generator.copy_if_needed_to_preserve_evaluation_order(original_callee.value());
+    //       Without arguments, nothing can overwrite them before the call.
+    auto this_value = arguments().is_empty() ? original_this_value : generator.copy_if_needed_to_preserve_evaluation_order(original_this_value);
+    auto callee = arguments().is_empty() ? original_callee.value() : generator.copy_if_needed_to_preserve_evaluation_order(original_callee.value());
 
     Optional<Bytecode::StringTableIndex> expression_string_index;
     if (auto expression_string = this->expression_string(); expression_string.has_value())
@@ -1818,13 +1819,7 @@ Bytecode::CodeGenerationErrorOr<Optional<ScopedOperand>> CallExpression::generat
                 argument_operands,
                 expression_string_index);
         } else {
-            generator.emit_with_extra_operand_slots<Bytecode::Op::Call>(
-                argument_operands.size(),
-                dst,
-                callee,
-                this_value,
-                argument_operands,
-                expression_string_index);
+            generator.emit_call(dst, callee, this_value, argument_operands, expression_string_index);
         }
     }
 
@@ -37,4 +37,35 @@ void BasicBlock::grow(size_t additional_size)
     m_buffer.resize(m_buffer.size() + additional_size);
 }
 
+void BasicBlock::remove_instructions_if(Function<bool(Instruction const&)> const& predicate)
+{
+    Vector<u8> buffer;
+    buffer.ensure_capacity(m_buffer.size());
+    HashMap<size_t, SourceRecord> source_map;
+    m_last_instruction_start_offset = 0;
+
+    Bytecode::InstructionStreamIterator it(instruction_stream());
+    while (!it.at_end()) {
+        auto& instruction = const_cast<Instruction&>(*it);
+        auto offset = it.offset();
+        auto length = instruction.length();
+        ++it;
+
+        if (predicate(instruction)) {
+            VERIFY(!it.at_end() || !m_terminated);
+            Instruction::destroy(instruction);
+            continue;
+        }
+
+        if (auto source_record = m_source_map.get(offset); source_record.has_value())
+            source_map.set(buffer.size(), *source_record);
+        m_last_instruction_start_offset = buffer.size();
+        buffer.append(reinterpret_cast<u8 const*>(&instruction), length);
+    }
+
+    // NOTE: The kept instructions have been moved into the new buffer, so the old one must not destroy them.
+    m_buffer = move(buffer);
+    m_source_map = move(source_map);
+}
+
 }
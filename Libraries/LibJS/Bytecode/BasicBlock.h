@@ -10,6 +10,7 @@
 #include <AK/String.h>
 #include <LibGC/Root.h>
 #include <LibJS/Bytecode/Executable.h>
+#include <LibJS/Bytecode/Instruction.h>
 #include <LibJS/Bytecode/ScopedOperand.h>
 #include <LibJS/Forward.h>
 
@@ -30,6 +31,7 @@ public:
     ~BasicBlock();
 
     u32 index() const { return m_index; }
+    void set_index(u32 index) { m_index = index; }
 
     ReadonlyBytes instruction_stream() const LIFETIME_BOUND { return m_buffer.span(); }
     u8* data() { return m_buffer.data(); }
@@ -44,9 +46,31 @@ public:
 
     void grow(size_t additional_size);
 
+    // Drops (and destroys) every instruction the predicate returns true for. Terminators must not be dropped.
+    void remove_instructions_if(Function<bool(Instruction const&)> const& predicate);
+
+    // NOTE: The arguments are taken by value, as they may refer to the terminator that is being replaced.
+    template<typename OpType, typename... Args>
+    void replace_terminator(Args... args)
+    {
+        static_assert(OpType::IsTerminator);
+        VERIFY(m_terminated);
+        auto offset = m_last_instruction_start_offset;
+        Instruction::destroy(*reinterpret_cast<Instruction*>(m_buffer.data() + offset));
+        m_buffer.resize_and_keep_capacity(offset);
+        grow(sizeof(OpType));
+        new (m_buffer.data() + offset) OpType(move(args)...);
+    }
+
     void terminate(Badge<Generator>) { m_terminated = true; }
     bool is_terminated() const { return m_terminated; }
 
+    Instruction const& terminator() const
+    {
+        VERIFY(m_terminated);
+        return *reinterpret_cast<Instruction const*>(m_buffer.data() + m_last_instruction_start_offset);
+    }
+
     String const& name() const { return m_name; }
 
     void set_handler(BasicBlock const& handler) { m_handler = &handler; }
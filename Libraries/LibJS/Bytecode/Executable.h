@@ -53,6 +53,19 @@ struct GlobalVariableCache : public PropertyLookupCache {
     bool in_module_environment { false };
 };
 
+// Remembers the ECMAScript function a call site called last, along with the size of its stack frame.
+// A call site that keeps switching between callees stops being cached once it has missed max_number_of_misses times.
+struct CallSiteCache {
+    static constexpr u8 max_number_of_misses = 4;
+
+    bool is_megamorphic() const { return number_of_misses >= max_number_of_misses; }
+
+    WeakPtr<ECMAScriptFunctionObject> callee;
+    u32 registers_and_constants_and_locals_count { 0 };
+    u32 argument_count { 0 };
+    u8 number_of_misses { 0 };
+};
+
 struct SourceRecord {
     u32 source_start_offset {};
     u32 source_end_offset {};
@@ -72,6 +85,7 @@ public:
         NonnullRefPtr<SourceCode const>,
         size_t number_of_property_lookup_caches,
         size_t number_of_global_variable_caches,
+        size_t number_of_call_site_caches,
         size_t number_of_registers,
         bool is_strict_mode);
 
@@ -81,6 +95,7 @@ public:
     Vector<u8> bytecode;
     Vector<PropertyLookupCache> property_lookup_caches;
     Vector<GlobalVariableCache> global_variable_caches;
+    Vector<CallSiteCache> call_site_caches;
     NonnullOwnPtr<StringTable> string_table;
     NonnullOwnPtr<IdentifierTable> identifier_table;
     NonnullOwnPtr<RegexTable> regex_table;
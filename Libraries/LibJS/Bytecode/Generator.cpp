@@ -11,6 +11,7 @@
 #include <LibJS/Bytecode/Generator.h>
 #include <LibJS/Bytecode/Instruction.h>
 #include <LibJS/Bytecode/Op.h>
+#include <LibJS/Bytecode/PassManager.h>
 #include <LibJS/Bytecode/Register.h>
 #include <LibJS/Runtime/ECMAScriptFunctionObject.h>
 #include <LibJS/Runtime/VM.h>
@@ -260,6 +261,17 @@ CodeGenerationErrorOr<GC::Ref<Executable>> Generator::compile(VM& vm, ASTNode co
         }
     }
 
+    if (g_optimize_bytecode) {
+        if (g_dump_bytecode_passes)
+            warnln("\033[37;1mOptimizing bytecode\033[0m for {}", function ? function->name() : "top-level code"_utf16_fly_string);
+        PassPipelineExecutable pipeline_executable {
+            .basic_blocks = generator.m_root_basic_blocks,
+            .constants = generator.m_constants,
+            .number_of_registers = generator.m_next_register,
+        };
+        PassManager::default_pipeline().perform(pipeline_executable);
+    }
+
     bool is_strict_mode = false;
     if (is<Program>(node))
         is_strict_mode = static_cast<Program const&>(node).is_strict_mode();
@@ -452,6 +464,7 @@ CodeGenerationErrorOr<GC::Ref<Executable>> Generator::compile(VM& vm, ASTNode co
         node.source_code(),
         generator.m_next_property_lookup_cache,
         generator.m_next_global_variable_cache,
+        generator.m_next_call_site_cache,
         generator.m_next_register,
         is_strict_mode);
 
@@ -1119,6 +1132,34 @@ void Generator::emit_get_by_id(ScopedOperand dst, ScopedOperand base, Identifier
     emit<Op::GetById>(dst, base, property_identifier, move(base_identifier), m_next_property_lookup_cache++);
 }
 
+bool Generator::fuse_get_by_id_and_call(ScopedOperand const& dst, ScopedOperand const& callee, ScopedOperand const& this_value, ReadonlySpan<ScopedOperand> arguments, Optional<StringTableIndex> expression_string)
+{
+    auto& last_instruction = *reinterpret_cast<Instruction const*>(m_current_basic_block->data() + m_current_basic_block->last_instruction_start_offset());
+    if (last_instruction.type() != Instruction::Type::GetById)
+        return false;
+
+    auto& get_by_id = static_cast<Op::GetById const&>(last_instruction);
+    if (get_by_id.dst() != callee.operand() || get_by_id.base() != this_value.operand())
+        return false;
+
+    auto base = get_by_id.base();
+    auto property = get_by_id.property();
+    auto base_identifier = get_by_id.base_identifier();
+    auto cache_index = get_by_id.cache_index();
+    m_current_basic_block->rewind();
+    emit_with_extra_operand_slots<Op::GetByIdAndCall>(arguments.size(), dst, callee, base, property, move(base_identifier), cache_index, arguments, m_next_call_site_cache++, expression_string);
+    return true;
+}
+
+void Generator::emit_call(ScopedOperand dst, ScopedOperand callee, ScopedOperand this_value, ReadonlySpan<ScopedOperand> arguments, Optional<StringTableIndex> expression_string)
+{
+    // OPTIMIZATION: Method calls whose arguments didn't need any instructions of their own directly follow the
+    //               GetById that loaded the callee, so both are dispatched as a single instruction.
+    if (m_current_basic_block->size() > 0 && fuse_get_by_id_and_call(dst, callee, this_value, arguments, expression_string))
+        return;
+    emit_with_extra_operand_slots<Op::Call>(arguments.size(), dst, callee, this_value, arguments, m_next_call_site_cache++, expression_string);
+}
+
 void Generator::emit_get_by_id_with_this(ScopedOperand dst, ScopedOperand base, IdentifierTableIndex id, ScopedOperand this_value)
 {
     if (m_identifier_table->get(id) == "length"sv) {
@@ -1284,6 +1325,23 @@ bool Generator::fuse_compare_and_jump(ScopedOperand const& condition, Label true
     return false;
 }
 
+bool Generator::fuse_not_and_jump(ScopedOperand const& condition, Label true_target, Label false_target)
+{
+    auto& last_instruction = *reinterpret_cast<Instruction const*>(m_current_basic_block->data() + m_current_basic_block->last_instruction_start_offset());
+    if (last_instruction.type() != Instruction::Type::Not)
+        return false;
+
+    auto& not_instruction = static_cast<Op::Not const&>(last_instruction);
+    if (not_instruction.dst() != condition.operand())
+        return false;
+
+    // NOTE: Not can't throw or have side effects, so jumping on its source with swapped targets is equivalent.
+    auto src = not_instruction.src();
+    m_current_basic_block->rewind();
+    emit<Op::JumpIf>(src, false_target, true_target);
+    return true;
+}
+
 void Generator::emit_jump_if(ScopedOperand const& condition, Label true_target, Label false_target)
 {
     if (condition.operand().is_constant()) {
@@ -1304,6 +1362,8 @@ void Generator::emit_jump_if(ScopedOperand const& condition, Label true_target,
         && m_current_basic_block->size() > 0) {
         if (fuse_compare_and_jump(condition, true_target, false_target))
             return;
+        if (fuse_not_and_jump(condition, true_target, false_target))
+            return;
     }
 
     emit<Op::JumpIf>(condition, true_target, false_target);
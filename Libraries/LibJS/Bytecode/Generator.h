@@ -326,6 +326,8 @@ public:
 
     void emit_get_by_id_with_this(ScopedOperand dst, ScopedOperand base, IdentifierTableIndex, ScopedOperand this_value);
 
+    void emit_call(ScopedOperand dst, ScopedOperand callee, ScopedOperand this_value, ReadonlySpan<ScopedOperand> arguments, Optional<StringTableIndex> expression_string);
+
     void emit_get_by_value(ScopedOperand dst, ScopedOperand base, ScopedOperand property, Optional<IdentifierTableIndex> base_identifier = {});
     void emit_get_by_value_with_this(ScopedOperand dst, ScopedOperand base, ScopedOperand property, ScopedOperand this_value);
 
@@ -339,6 +341,7 @@ public:
 
     [[nodiscard]] size_t next_global_variable_cache() { return m_next_global_variable_cache++; }
     [[nodiscard]] size_t next_property_lookup_cache() { return m_next_property_lookup_cache++; }
+    [[nodiscard]] size_t next_call_site_cache() { return m_next_call_site_cache++; }
 
     enum class DeduplicateConstant {
         Yes,
@@ -377,6 +380,8 @@ private:
 
     // Returns true if a fused instruction was emitted.
     [[nodiscard]] bool fuse_compare_and_jump(ScopedOperand const& condition, Label true_target, Label false_target);
+    [[nodiscard]] bool fuse_not_and_jump(ScopedOperand const& condition, Label true_target, Label false_target);
+    [[nodiscard]] bool fuse_get_by_id_and_call(ScopedOperand const& dst, ScopedOperand const& callee, ScopedOperand const& this_value, ReadonlySpan<ScopedOperand> arguments, Optional<StringTableIndex> expression_string);
 
     struct LabelableScope {
         Label bytecode_target;
@@ -409,6 +414,7 @@ private:
     u32 m_next_block { 1 };
     u32 m_next_property_lookup_cache { 0 };
     u32 m_next_global_variable_cache { 0 };
+    u32 m_next_call_site_cache { 0 };
     FunctionKind m_enclosing_function_kind { FunctionKind::Normal };
     Vector<LabelableScope> m_continuable_scopes;
     Vector<LabelableScope> m_breakable_scopes;
@@ -54,6 +54,7 @@
     O(EnterUnwindContext)              \
     O(Exp)                             \
     O(GetById)                         \
+    O(GetByIdAndCall)                  \
     O(GetByIdWithThis)                 \
     O(GetByValue)                      \
     O(GetByValueWithThis)              \
@@ -7,6 +7,7 @@
 
 #include <AK/Debug.h>
 #include <AK/HashTable.h>
+#include <AK/QuickSort.h>
 #include <AK/TemporaryChange.h>
 #include <LibGC/RootHashMap.h>
 #include <LibJS/AST.h>
@@ -45,6 +46,7 @@
 namespace JS::Bytecode {
 
 bool g_dump_bytecode = false;
+bool g_count_bytecode_bigrams = false;
 
 static ByteString format_operand(StringView name, Operand operand, Bytecode::Executable const& executable)
 {
@@ -340,7 +342,63 @@ NEVER_INLINE Interpreter::HandleExceptionResponse Interpreter::handle_exception(
 #    define FLATTEN_ON_CLANG
 #endif
 
-FLATTEN_ON_CLANG void Interpreter::run_bytecode(size_t entry_point)
+static constexpr size_t bytecode_op_count = 0
+#define __BYTECODE_OP(op) +1
+    ENUMERATE_BYTECODE_OPS(__BYTECODE_OP)
+#undef __BYTECODE_OP
+    ;
+
+static constexpr StringView bytecode_op_names[] = {
+#define __BYTECODE_OP(op) #op##sv,
+    ENUMERATE_BYTECODE_OPS(__BYTECODE_OP)
+#undef __BYTECODE_OP
+};
+
+// Indexed by `first * bytecode_op_count + second`, allocated on first use.
+static Vector<u64> s_bytecode_bigram_counts;
+
+static void count_bytecode_bigram(Optional<Instruction::Type>& previous_type, Instruction::Type type)
+{
+    if (previous_type.has_value()) {
+        if (s_bytecode_bigram_counts.is_empty())
+            s_bytecode_bigram_counts.resize(bytecode_op_count * bytecode_op_count);
+        ++s_bytecode_bigram_counts[to_underlying(*previous_type) * bytecode_op_count + to_underlying(type)];
+    }
+    previous_type = type;
+}
+
+void dump_bytecode_bigram_counts()
+{
+    Vector<size_t> bigrams;
+    u64 total = 0;
+    for (size_t i = 0; i < s_bytecode_bigram_counts.size(); ++i) {
+        if (s_bytecode_bigram_counts[i] == 0)
+            continue;
+        bigrams.append(i);
+        total += s_bytecode_bigram_counts[i];
+    }
+    quick_sort(bigrams, [](size_t a, size_t b) { return s_bytecode_bigram_counts[a] > s_bytecode_bigram_counts[b]; });
+
+    warnln("Bytecode bigrams ({} dispatches):", total);
+    for (auto bigram : bigrams) {
+        auto count = s_bytecode_bigram_counts[bigram];
+        warnln("{:>14} {:>6.2}%  {} -> {}",
+            count,
+            static_cast<double>(count) * 100 / static_cast<double>(total),
+            bytecode_op_names[bigram / bytecode_op_count],
+            bytecode_op_names[bigram % bytecode_op_count]);
+    }
+}
+
+void Interpreter::run_bytecode(size_t entry_point)
+{
+    if (g_count_bytecode_bigrams) [[unlikely]]
+        return run_bytecode_impl<true>(entry_point);
+    return run_bytecode_impl<false>(entry_point);
+}
+
+template<bool count_bigrams>
+FLATTEN_ON_CLANG void Interpreter::run_bytecode_impl(size_t entry_point)
 {
     if (vm().did_reach_stack_space_limit()) [[unlikely]] {
         reg(Register::exception()) = vm().throw_completion<InternalError>(ErrorType::CallStackSizeExceeded).value();
@@ -364,6 +422,15 @@ FLATTEN_ON_CLANG void Interpreter::run_bytecode(size_t entry_point)
     };
 #undef SET_UP_LABEL
 
+    // NOTE: Only used when counting bigrams, to remember what was dispatched last in this executable.
+    [[maybe_unused]] Optional<Instruction::Type> previous_instruction_type;
+
+#define COUNT_BIGRAM(type)                                            \
+    do {                                                              \
+        if constexpr (count_bigrams)                                  \
+            count_bytecode_bigram(previous_instruction_type, (type)); \
+    } while (0)
+
 #define DISPATCH_NEXT(name)                                                                         \
     do {                                                                                            \
         if constexpr (Op::name::IsVariableLength)                                                   \
@@ -371,12 +438,14 @@ FLATTEN_ON_CLANG void Interpreter::run_bytecode(size_t entry_point)
         else                                                                                        \
             program_counter += sizeof(Op::name);                                                    \
         auto& next_instruction = *reinterpret_cast<Instruction const*>(&bytecode[program_counter]); \
+        COUNT_BIGRAM(next_instruction.type());                                                      \
         goto* bytecode_dispatch_table[static_cast<size_t>(next_instruction.type())];                \
     } while (0)
 
     for (;;) {
     start:
         for (;;) {
+            COUNT_BIGRAM((*reinterpret_cast<Instruction const*>(&bytecode[program_counter])).type());
             goto* bytecode_dispatch_table[static_cast<size_t>((*reinterpret_cast<Instruction const*>(&bytecode[program_counter])).type())];
 
         handle_Mov: {
@@ -465,6 +534,55 @@ FLATTEN_ON_CLANG void Interpreter::run_bytecode(size_t entry_point)
             JS_ENUMERATE_COMPARISON_OPS(HANDLE_COMPARISON_OP)
 #undef HANDLE_COMPARISON_OP
 
+        // OPTIMIZATION: The Int32 fast paths of the hottest arithmetic instructions are handled directly
+        //               in the dispatch loop, so tight numeric loops never leave it. Everything else
+        //               (doubles, overflow, strings, BigInts, ...) falls through to execute_impl().
+#define HANDLE_ARITHMETIC_OP(op_TitleCase, checked_operation, numeric_operator)                                         \
+    handle_##op_TitleCase:                                                                                              \
+    {                                                                                                                   \
+        auto& instruction = *reinterpret_cast<Op::op_TitleCase const*>(&bytecode[program_counter]);                     \
+        auto lhs = get(instruction.lhs());                                                                              \
+        auto rhs = get(instruction.rhs());                                                                              \
+        if (lhs.is_int32() && rhs.is_int32()                                                                            \
+            && !Checked<i32>::checked_operation##_would_overflow(lhs.as_i32(), rhs.as_i32())) [[likely]] {              \
+            set(instruction.dst(), Value(lhs.as_i32() numeric_operator rhs.as_i32()));                                  \
+            DISPATCH_NEXT(op_TitleCase);                                                                                \
+        }                                                                                                               \
+        auto result = instruction.execute_impl(*this);                                                                  \
+        if (result.is_error()) [[unlikely]] {                                                                           \
+            if (handle_exception(program_counter, result.error_value()) == HandleExceptionResponse::ExitFromExecutable) \
+                return;                                                                                                 \
+            goto start;                                                                                                 \
+        }                                                                                                               \
+        DISPATCH_NEXT(op_TitleCase);                                                                                    \
+    }
+
+            HANDLE_ARITHMETIC_OP(Add, addition, +)
+            HANDLE_ARITHMETIC_OP(Sub, subtraction, -)
+#undef HANDLE_ARITHMETIC_OP
+
+#define HANDLE_INCREMENT_OR_DECREMENT_OP(op_TitleCase, limit, numeric_operator)                                         \
+    handle_##op_TitleCase:                                                                                              \
+    {                                                                                                                   \
+        auto& instruction = *reinterpret_cast<Op::op_TitleCase const*>(&bytecode[program_counter]);                     \
+        auto value = get(instruction.dst());                                                                            \
+        if (value.is_int32() && value.as_i32() != NumericLimits<i32>::limit()) [[likely]] {                             \
+            set(instruction.dst(), Value { value.as_i32() numeric_operator 1 });                                        \
+            DISPATCH_NEXT(op_TitleCase);                                                                                \
+        }                                                                                                               \
+        auto result = instruction.execute_impl(*this);                                                                  \
+        if (result.is_error()) [[unlikely]] {                                                                           \
+            if (handle_exception(program_counter, result.error_value()) == HandleExceptionResponse::ExitFromExecutable) \
+                return;                                                                                                 \
+            goto start;                                                                                                 \
+        }                                                                                                               \
+        DISPATCH_NEXT(op_TitleCase);                                                                                    \
+    }
+
+            HANDLE_INCREMENT_OR_DECREMENT_OP(Increment, max, +)
+            HANDLE_INCREMENT_OR_DECREMENT_OP(Decrement, min, -)
+#undef HANDLE_INCREMENT_OR_DECREMENT_OP
+
         handle_JumpUndefined: {
             auto& instruction = *reinterpret_cast<Op::JumpUndefined const*>(&bytecode[program_counter]);
             if (get(instruction.condition()).is_undefined())
@@ -549,7 +667,6 @@ FLATTEN_ON_CLANG void Interpreter::run_bytecode(size_t entry_point)
         DISPATCH_NEXT(name);                                                                \
     }
 
-            HANDLE_INSTRUCTION(Add);
             HANDLE_INSTRUCTION_WITHOUT_EXCEPTION_CHECK(AddPrivateName);
             HANDLE_INSTRUCTION(ArrayAppend);
             HANDLE_INSTRUCTION(AsyncIteratorClose);
@@ -574,7 +691,6 @@ FLATTEN_ON_CLANG void Interpreter::run_bytecode(size_t entry_point)
             HANDLE_INSTRUCTION(CreateVariable);
             HANDLE_INSTRUCTION_WITHOUT_EXCEPTION_CHECK(CreateRestParams);
             HANDLE_INSTRUCTION_WITHOUT_EXCEPTION_CHECK(CreateArguments);
-            HANDLE_INSTRUCTION(Decrement);
             HANDLE_INSTRUCTION(DeleteById);
             HANDLE_INSTRUCTION(DeleteByIdWithThis);
             HANDLE_INSTRUCTION(DeleteByValue);
@@ -585,6 +701,7 @@ FLATTEN_ON_CLANG void Interpreter::run_bytecode(size_t entry_point)
             HANDLE_INSTRUCTION(EnterObjectEnvironment);
             HANDLE_INSTRUCTION(Exp);
             HANDLE_INSTRUCTION(GetById);
+            HANDLE_INSTRUCTION(GetByIdAndCall);
             HANDLE_INSTRUCTION(GetByIdWithThis);
             HANDLE_INSTRUCTION(GetByValue);
             HANDLE_INSTRUCTION(GetByValueWithThis);
@@ -608,7 +725,6 @@ FLATTEN_ON_CLANG void Interpreter::run_bytecode(size_t entry_point)
             HANDLE_INSTRUCTION(HasPrivateId);
             HANDLE_INSTRUCTION(ImportCall);
             HANDLE_INSTRUCTION(In);
-            HANDLE_INSTRUCTION(Increment);
             HANDLE_INSTRUCTION(InitializeLexicalBinding);
             HANDLE_INSTRUCTION(InitializeVariableBinding);
             HANDLE_INSTRUCTION(InstanceOf);
@@ -655,7 +771,6 @@ FLATTEN_ON_CLANG void Interpreter::run_bytecode(size_t entry_point)
             HANDLE_INSTRUCTION(SetVariableBinding);
             HANDLE_INSTRUCTION(StrictlyEquals);
             HANDLE_INSTRUCTION(StrictlyInequals);
-            HANDLE_INSTRUCTION(Sub);
             HANDLE_INSTRUCTION(SuperCallWithArgumentArray);
             HANDLE_INSTRUCTION(Throw);
             HANDLE_INSTRUCTION(ThrowIfNotObject);
@@ -1049,6 +1164,13 @@ inline ThrowCompletionOr<Value> get_by_value(VM& vm, Optional<IdentifierTableInd
         // For "non-typed arrays":
         if (!object.may_interfere_with_indexed_property_access()
             && object_storage) {
+            // OPTIMIZATION: Storage without holes that only holds numbers can't contain accessors or empty slots,
+            //               so any in-bounds element can be returned as is.
+            if (object_storage->is_simple_storage()) {
+                auto const& simple_storage = static_cast<SimpleIndexedPropertyStorage const&>(*object_storage);
+                if (index < simple_storage.array_like_size() && simple_storage.holds_only_packed_numbers())
+                    return simple_storage.elements().data()[index];
+            }
             auto maybe_value = [&] {
                 if (object_storage->is_simple_storage())
                     return static_cast<SimpleIndexedPropertyStorage const*>(object_storage)->inline_get(index);
@@ -1427,11 +1549,17 @@ inline ThrowCompletionOr<void> put_by_value(VM& vm, Value base, Optional<Utf16Fl
         if (storage
             && storage->is_simple_storage()
             && !object.may_interfere_with_indexed_property_access()) {
-            auto maybe_value = storage->get(index);
+            auto& simple_storage = static_cast<SimpleIndexedPropertyStorage&>(*storage);
+            // OPTIMIZATION: Storage without holes that only holds numbers has a plain data property at every in-bounds index.
+            if (index < simple_storage.array_like_size() && simple_storage.holds_only_packed_numbers()) {
+                simple_storage.put(index, value);
+                return {};
+            }
+            auto maybe_value = simple_storage.inline_get(index);
             if (maybe_value.has_value()) {
                 auto existing_value = maybe_value->value;
                 if (!existing_value.is_accessor()) {
-                    storage->put(index, value);
+                    simple_storage.put(index, value);
                     return {};
                 }
             }
@@ -2830,6 +2958,19 @@ static ThrowCompletionOr<Value> dispatch_builtin_call(Bytecode::Interpreter& int
     VERIFY_NOT_REACHED();
 }
 
+ALWAYS_INLINE static void copy_call_arguments(Bytecode::Interpreter& interpreter, ExecutionContext& callee_context, ReadonlySpan<Operand> arguments)
+{
+    auto* callee_context_argument_values = callee_context.arguments.data();
+    auto const callee_context_argument_count = callee_context.arguments.size();
+    auto const insn_argument_count = arguments.size();
+
+    for (size_t i = 0; i < insn_argument_count; ++i)
+        callee_context_argument_values[i] = interpreter.get(arguments[i]);
+    for (size_t i = insn_argument_count; i < callee_context_argument_count; ++i)
+        callee_context_argument_values[i] = js_undefined();
+    callee_context.passed_argument_count = insn_argument_count;
+}
+
 template<CallType call_type>
 static ThrowCompletionOr<void> execute_call(
     Bytecode::Interpreter& interpreter,
@@ -2849,15 +2990,7 @@ static ThrowCompletionOr<void> execute_call(
     TRY(function.get_stack_frame_size(registers_and_constants_and_locals_count, argument_count));
     ALLOCATE_EXECUTION_CONTEXT_ON_NATIVE_STACK_WITHOUT_CLEARING_ARGS(callee_context, registers_and_constants_and_locals_count, max(arguments.size(), argument_count));
 
-    auto* callee_context_argument_values = callee_context->arguments.data();
-    auto const callee_context_argument_count = callee_context->arguments.size();
-    auto const insn_argument_count = arguments.size();
-
-    for (size_t i = 0; i < insn_argument_count; ++i)
-        callee_context_argument_values[i] = interpreter.get(arguments[i]);
-    for (size_t i = insn_argument_count; i < callee_context_argument_count; ++i)
-        callee_context_argument_values[i] = js_undefined();
-    callee_context->passed_argument_count = insn_argument_count;
+    copy_call_arguments(interpreter, *callee_context, arguments);
 
     Value retval;
     if (call_type == CallType::DirectEval && callee == interpreter.realm().intrinsics().eval_function()) {
@@ -2871,9 +3004,71 @@ static ThrowCompletionOr<void> execute_call(
     return {};
 }
 
+static ThrowCompletionOr<void> call_cached_function(
+    Bytecode::Interpreter& interpreter,
+    ECMAScriptFunctionObject& function,
+    CallSiteCache const& cache,
+    Value this_value,
+    ReadonlySpan<Operand> arguments,
+    Operand dst)
+{
+    ExecutionContext* callee_context = nullptr;
+    ALLOCATE_EXECUTION_CONTEXT_ON_NATIVE_STACK_WITHOUT_CLEARING_ARGS(callee_context, cache.registers_and_constants_and_locals_count, max<size_t>(arguments.size(), cache.argument_count));
+    copy_call_arguments(interpreter, *callee_context, arguments);
+    interpreter.set(dst, TRY(function.call_non_class_constructor(*callee_context, this_value)));
+    return {};
+}
+
+// OPTIMIZATION: A call site that calls the same ECMAScript function again doesn't need to check that the callee is
+//               callable or a class constructor, or ask it for the size of its stack frame; the frame is set up from
+//               the cached sizes and pushed straight away. Call sites that keep switching callees go megamorphic and
+//               take the generic path without touching the cache again.
+static ThrowCompletionOr<void> execute_call_with_cache(
+    Bytecode::Interpreter& interpreter,
+    CallSiteCache& cache,
+    Value callee,
+    Value this_value,
+    ReadonlySpan<Operand> arguments,
+    Operand dst,
+    Optional<StringTableIndex> const& expression_string)
+{
+    if (callee.is_object()) {
+        auto& callee_object = callee.as_object();
+        if (auto* cached_function = cache.callee.ptr(); cached_function == &callee_object) [[likely]]
+            return call_cached_function(interpreter, *cached_function, cache, this_value, arguments, dst);
+
+        // NOTE: Class constructors always throw when called, so there is no point in caching them.
+        if (auto* function = as_if<ECMAScriptFunctionObject>(callee_object); function && !function->is_class_constructor() && !cache.is_megamorphic()) {
+            ++cache.number_of_misses;
+            if (!cache.is_megamorphic()) {
+                size_t registers_and_constants_and_locals_count = 0;
+                size_t argument_count = 0;
+                TRY(function->get_stack_frame_size(registers_and_constants_and_locals_count, argument_count));
+                cache.callee = *function;
+                cache.registers_and_constants_and_locals_count = registers_and_constants_and_locals_count;
+                cache.argument_count = argument_count;
+                return call_cached_function(interpreter, *function, cache, this_value, arguments, dst);
+            }
+            cache.callee = nullptr;
+        }
+    }
+    return execute_call<CallType::Call>(interpreter, callee, this_value, arguments, dst, expression_string);
+}
+
 ThrowCompletionOr<void> Call::execute_impl(Bytecode::Interpreter& interpreter) const
 {
-    return execute_call<CallType::Call>(interpreter, interpreter.get(m_callee), interpreter.get(m_this_value), { m_arguments, m_argument_count }, m_dst, m_expression_string);
+    auto& cache = interpreter.current_executable().call_site_caches[m_call_site_cache_index];
+    return execute_call_with_cache(interpreter, cache, interpreter.get(m_callee), interpreter.get(m_this_value), { m_arguments, m_argument_count }, m_dst, m_expression_string);
+}
+
+ThrowCompletionOr<void> GetByIdAndCall::execute_impl(Bytecode::Interpreter& interpreter) const
+{
+    auto base_value = interpreter.get(m_base);
+    auto& executable = interpreter.current_executable();
+    auto& cache = executable.property_lookup_caches[m_cache_index];
+    auto callee = TRY(get_by_id(interpreter.vm(), m_base_identifier, m_property, base_value, base_value, cache, executable));
+    interpreter.set(m_callee, callee);
+    return execute_call_with_cache(interpreter, executable.call_site_caches[m_call_site_cache_index], callee, base_value, { m_arguments, m_argument_count }, m_dst, m_expression_string);
 }
 
 NEVER_INLINE ThrowCompletionOr<void> CallConstruct::execute_impl(Bytecode::Interpreter& interpreter) const
@@ -3106,6 +3301,15 @@ ThrowCompletionOr<void> Decrement::execute_impl(Bytecode::Interpreter& interpret
     auto& vm = interpreter.vm();
     auto old_value = interpreter.get(dst());
 
+    // OPTIMIZATION: Fast path for Int32 values.
+    if (old_value.is_int32()) {
+        auto integer_value = old_value.as_i32();
+        if (integer_value != NumericLimits<i32>::min()) [[likely]] {
+            interpreter.set(dst(), Value { integer_value - 1 });
+            return {};
+        }
+    }
+
     old_value = TRY(old_value.to_numeric(vm));
 
     if (old_value.is_number())
@@ -3120,6 +3324,16 @@ ThrowCompletionOr<void> PostfixDecrement::execute_impl(Bytecode::Interpreter& in
     auto& vm = interpreter.vm();
     auto old_value = interpreter.get(m_src);
 
+    // OPTIMIZATION: Fast path for Int32 values.
+    if (old_value.is_int32()) {
+        auto integer_value = old_value.as_i32();
+        if (integer_value != NumericLimits<i32>::min()) [[likely]] {
+            interpreter.set(m_dst, old_value);
+            interpreter.set(m_src, Value { integer_value - 1 });
+            return {};
+        }
+    }
+
     old_value = TRY(old_value.to_numeric(vm));
     interpreter.set(m_dst, old_value);
 
@@ -3794,6 +4008,24 @@ ByteString Call::to_byte_string_impl(Bytecode::Executable const& executable) con
     return builder.to_byte_string();
 }
 
+ByteString GetByIdAndCall::to_byte_string_impl(Bytecode::Executable const& executable) const
+{
+    StringBuilder builder;
+    builder.appendff("GetByIdAndCall {}, {}, {}, {}, ",
+        format_operand("dst"sv, m_dst, executable),
+        format_operand("callee"sv, m_callee, executable),
+        format_operand("base"sv, m_base, executable),
+        executable.identifier_table->get(m_property));
+
+    builder.append(format_operand_list("args"sv, { m_arguments, m_argument_count }, executable));
+
+    if (m_expression_string.has_value()) {
+        builder.appendff(", `{}`", executable.get_string(m_expression_string.value()));
+    }
+
+    return builder.to_byte_string();
+}
+
 ByteString CallConstruct::to_byte_string_impl(Bytecode::Executable const& executable) const
 {
     StringBuilder builder;
@@ -90,6 +90,8 @@ public:
 
 private:
     void run_bytecode(size_t entry_point);
+    template<bool count_bigrams>
+    void run_bytecode_impl(size_t entry_point);
 
     enum class HandleExceptionResponse {
         ExitFromExecutable,
@@ -109,6 +111,10 @@ private:
 };
 
 JS_API extern bool g_dump_bytecode;
+JS_API extern bool g_count_bytecode_bigrams;
+
+// Prints how often each pair of consecutive instructions was dispatched while g_count_bytecode_bigrams was set.
+JS_API void dump_bytecode_bigram_counts();
 
 ThrowCompletionOr<GC::Ref<Bytecode::Executable>> compile(VM&, ASTNode const&, JS::FunctionKind kind, Utf16FlyString const& name);
 ThrowCompletionOr<GC::Ref<Bytecode::Executable>> compile(VM&, ECMAScriptFunctionObject const&);
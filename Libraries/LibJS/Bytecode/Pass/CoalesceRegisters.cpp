@@ -0,0 +1,182 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/NumericLimits.h>
+#include <AK/QuickSort.h>
+#include <LibJS/Bytecode/Op.h>
+#include <LibJS/Bytecode/PassManager.h>
+#include <LibJS/Bytecode/Register.h>
+
+namespace JS::Bytecode::Passes {
+
+// Live ranges are computed over the linear order of the instructions, so a range may be larger than the set of points
+// where the register is actually live, but never smaller. Instructions don't tell us which of their operands they
+// write, so every occurrence of a register counts as a use; this is why a range starts at the first occurrence
+// instead of at a definition.
+struct LiveRange {
+    u32 first { NumericLimits<u32>::max() };
+    u32 last { 0 };
+
+    bool is_used() const { return first <= last; }
+};
+
+// A control flow edge that goes backwards (or stays in place) in the linear order of the instructions.
+struct BackEdge {
+    u32 from { 0 };
+    u32 to { 0 };
+};
+
+// Don't spend unbounded time on huge functions; they simply keep their registers as they are.
+static constexpr size_t max_range_and_edge_product = 1 << 24;
+
+// Extending a range across one back edge can make it overlap another, so extending ranges may take many sweeps over the
+// back edges. This bounds the total number of edges looked at; functions that need more keep their registers as they are.
+static constexpr size_t max_back_edge_visits = 4 * max_range_and_edge_product;
+
+bool CoalesceRegisters::perform(PassPipelineExecutable& executable) const
+{
+    auto& blocks = executable.basic_blocks;
+    auto const first_register = Register::reserved_register_count;
+    if (executable.number_of_registers <= first_register)
+        return false;
+
+    auto is_coalescable = [&](Operand const& operand) {
+        return operand.is_register() && operand.index() >= first_register;
+    };
+
+    // Number every instruction. Each block gets one more position at its end, for the End instruction that is
+    // appended to unterminated blocks when linking.
+    Vector<u32> block_start;
+    Vector<u32> block_end;
+    block_start.ensure_capacity(blocks.size());
+    block_end.ensure_capacity(blocks.size());
+
+    Vector<LiveRange> ranges;
+    ranges.resize(executable.number_of_registers - first_register);
+
+    struct LabelEdge {
+        u32 from { 0 };
+        size_t target_block { 0 };
+    };
+    Vector<LabelEdge> label_edges;
+    Vector<size_t> scheduled_jump_targets;
+
+    u32 position = 0;
+    for (auto& block : blocks) {
+        block_start.unchecked_append(position);
+        for (InstructionStreamIterator it(block->instruction_stream()); !it.at_end(); ++it, ++position) {
+            auto& instruction = const_cast<Instruction&>(*it);
+            instruction.visit_operands([&](Operand& operand) {
+                if (!is_coalescable(operand))
+                    return;
+                auto& range = ranges[operand.index() - first_register];
+                range.first = min(range.first, position);
+                range.last = max(range.last, position);
+            });
+            instruction.visit_labels([&](Label& label) {
+                label_edges.append({ position, label.basic_block_index() });
+            });
+            // NOTE: A scheduled jump is taken by whatever leaves the finalizer later on, not by the instruction itself.
+            if (instruction.type() == Instruction::Type::ScheduleJump)
+                scheduled_jump_targets.append(static_cast<Op::ScheduleJump const&>(instruction).target().basic_block_index());
+        }
+        block_end.unchecked_append(position);
+        ++position;
+    }
+    auto const last_position = position - 1;
+
+    Vector<BackEdge> back_edges;
+    auto add_edge = [&](u32 from, size_t target_block) {
+        auto to = block_start[target_block];
+        if (to <= from)
+            back_edges.append({ from, to });
+    };
+    for (auto& edge : label_edges)
+        add_edge(edge.from, edge.target_block);
+    for (auto target_block : scheduled_jump_targets)
+        add_edge(last_position, target_block);
+    for (size_t i = 0; i < blocks.size(); ++i) {
+        // NOTE: Any instruction in a block may throw, so treat the end of the block as the origin of the exceptional edges.
+        if (auto const* handler = blocks[i]->handler())
+            add_edge(block_end[i], handler->index());
+        if (auto const* finalizer = blocks[i]->finalizer())
+            add_edge(block_end[i], finalizer->index());
+    }
+
+    Vector<u32> used_registers;
+    for (u32 i = 0; i < ranges.size(); ++i) {
+        if (ranges[i].is_used())
+            used_registers.append(i);
+    }
+
+    if (used_registers.size() * max<size_t>(back_edges.size(), 1) > max_range_and_edge_product)
+        return false;
+
+    // A value that is live anywhere inside a loop may be carried around it, so it has to stay live for the whole loop.
+    size_t remaining_back_edge_visits = max_back_edge_visits;
+    for (auto index : used_registers) {
+        auto& range = ranges[index];
+        bool extended = true;
+        while (extended) {
+            // NOTE: Nothing has been renumbered yet, so giving up here leaves the executable untouched.
+            if (remaining_back_edge_visits < back_edges.size())
+                return false;
+            remaining_back_edge_visits -= back_edges.size();
+            extended = false;
+            for (auto& edge : back_edges) {
+                if (edge.to > range.last || edge.from < range.first)
+                    continue;
+                if (edge.to < range.first) {
+                    range.first = edge.to;
+                    extended = true;
+                }
+                if (edge.from > range.last) {
+                    range.last = edge.from;
+                    extended = true;
+                }
+            }
+        }
+    }
+
+    // Hand out slots in order of range start, reusing the lowest slot whose previous occupant's range has ended.
+    quick_sort(used_registers, [&](u32 a, u32 b) { return ranges[a].first < ranges[b].first; });
+
+    Vector<u32> new_indices;
+    new_indices.resize(ranges.size());
+    Vector<u32> slot_occupied_until;
+    bool renumbered = false;
+    for (auto index : used_registers) {
+        auto& range = ranges[index];
+        auto slot = slot_occupied_until.find_first_index_if([&](u32 last) { return last < range.first; });
+        if (slot.has_value()) {
+            slot_occupied_until[*slot] = range.last;
+        } else {
+            slot = slot_occupied_until.size();
+            slot_occupied_until.append(range.last);
+        }
+        new_indices[index] = *slot;
+        if (*slot != index)
+            renumbered = true;
+    }
+
+    auto new_register_count = first_register + static_cast<u32>(slot_occupied_until.size());
+    if (!renumbered && new_register_count == executable.number_of_registers)
+        return false;
+
+    for (auto& block : blocks) {
+        for (InstructionStreamIterator it(block->instruction_stream()); !it.at_end(); ++it) {
+            const_cast<Instruction&>(*it).visit_operands([&](Operand& operand) {
+                if (is_coalescable(operand))
+                    operand = Operand { Register { first_register + new_indices[operand.index() - first_register] } };
+            });
+        }
+    }
+
+    executable.number_of_registers = new_register_count;
+    return true;
+}
+
+}
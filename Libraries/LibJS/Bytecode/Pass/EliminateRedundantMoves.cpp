@@ -0,0 +1,57 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/HashTable.h>
+#include <LibJS/Bytecode/Op.h>
+#include <LibJS/Bytecode/PassManager.h>
+
+namespace JS::Bytecode::Passes {
+
+bool EliminateRedundantMoves::perform(PassPipelineExecutable& executable) const
+{
+    bool changed = false;
+    HashTable<Instruction const*> redundant_moves;
+
+    for (auto& block : executable.basic_blocks) {
+        redundant_moves.clear_with_capacity();
+
+        // NOTE: Moves can't throw, so nothing can observe the destination between two adjacent moves.
+        Op::Mov const* previous_move = nullptr;
+        for (InstructionStreamIterator it(block->instruction_stream()); !it.at_end(); ++it) {
+            if ((*it).type() != Instruction::Type::Mov) {
+                previous_move = nullptr;
+                continue;
+            }
+            auto const& mov = static_cast<Op::Mov const&>(*it);
+
+            // `mov a, a`
+            if (mov.dst() == mov.src()) {
+                redundant_moves.set(&mov);
+                continue;
+            }
+
+            if (previous_move && previous_move->dst() == mov.dst()) {
+                // `mov a, x; mov a, y`: The first move is overwritten before anything reads it.
+                redundant_moves.set(previous_move);
+            } else if (previous_move && previous_move->dst() == mov.src() && previous_move->src() == mov.dst()) {
+                // `mov a, b; mov b, a`: The second move stores the value b already has.
+                redundant_moves.set(&mov);
+                continue;
+            }
+            previous_move = &mov;
+        }
+
+        if (redundant_moves.is_empty())
+            continue;
+        block->remove_instructions_if([&](Instruction const& instruction) {
+            return redundant_moves.contains(&instruction);
+        });
+        changed = true;
+    }
+    return changed;
+}
+
+}
@@ -0,0 +1,148 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/Array.h>
+#include <LibJS/Bytecode/Op.h>
+#include <LibJS/Bytecode/PassManager.h>
+
+namespace JS::Bytecode::Passes {
+
+// Returns the outcome of a conditional jump if it can be computed without observable side effects.
+static Optional<bool> constant_outcome(Instruction const& instruction, GC::RootVector<Value> const& constants)
+{
+    auto constant = [&](Operand operand) -> Optional<Value> {
+        if (!operand.is_constant())
+            return {};
+        auto value = constants[operand.index()];
+        if (value.is_special_empty_value())
+            return {};
+        return value;
+    };
+
+    auto numeric_constants = [&](Operand lhs, Operand rhs) -> Optional<AK::Array<double, 2>> {
+        auto lhs_value = constant(lhs);
+        auto rhs_value = constant(rhs);
+        if (!lhs_value.has_value() || !rhs_value.has_value() || !lhs_value->is_number() || !rhs_value->is_number())
+            return {};
+        return AK::Array { lhs_value->as_double(), rhs_value->as_double() };
+    };
+
+    switch (instruction.type()) {
+    case Instruction::Type::JumpIf:
+        if (auto value = constant(static_cast<Op::JumpIf const&>(instruction).condition()); value.has_value())
+            return value->to_boolean();
+        return {};
+    case Instruction::Type::JumpNullish:
+        if (auto value = constant(static_cast<Op::JumpNullish const&>(instruction).condition()); value.has_value())
+            return value->is_nullish();
+        return {};
+    case Instruction::Type::JumpUndefined:
+        if (auto value = constant(static_cast<Op::JumpUndefined const&>(instruction).condition()); value.has_value())
+            return value->is_undefined();
+        return {};
+    case Instruction::Type::JumpStrictlyEquals: {
+        auto& jump = static_cast<Op::JumpStrictlyEquals const&>(instruction);
+        auto lhs = constant(jump.lhs());
+        auto rhs = constant(jump.rhs());
+        if (!lhs.has_value() || !rhs.has_value())
+            return {};
+        return is_strictly_equal(*lhs, *rhs);
+    }
+    case Instruction::Type::JumpStrictlyInequals: {
+        auto& jump = static_cast<Op::JumpStrictlyInequals const&>(instruction);
+        auto lhs = constant(jump.lhs());
+        auto rhs = constant(jump.rhs());
+        if (!lhs.has_value() || !rhs.has_value())
+            return {};
+        return !is_strictly_equal(*lhs, *rhs);
+    }
+    // NOTE: Comparing anything but two numbers may call user code or allocate, so only those are folded.
+#define FOLD_NUMERIC_COMPARISON(op_TitleCase, numeric_operator)                            \
+    case Instruction::Type::Jump##op_TitleCase: {                                          \
+        auto& jump = static_cast<Op::Jump##op_TitleCase const&>(instruction);              \
+        if (auto numbers = numeric_constants(jump.lhs(), jump.rhs()); numbers.has_value()) \
+            return (*numbers)[0] numeric_operator(*numbers)[1];                            \
+        return {};                                                                         \
+    }
+        FOLD_NUMERIC_COMPARISON(LessThan, <)
+        FOLD_NUMERIC_COMPARISON(LessThanEquals, <=)
+        FOLD_NUMERIC_COMPARISON(GreaterThan, >)
+        FOLD_NUMERIC_COMPARISON(GreaterThanEquals, >=)
+        FOLD_NUMERIC_COMPARISON(LooselyEquals, ==)
+        FOLD_NUMERIC_COMPARISON(LooselyInequals, !=)
+#undef FOLD_NUMERIC_COMPARISON
+    default:
+        return {};
+    }
+}
+
+// Returns the targets of a conditional jump whose condition can be evaluated without side effects.
+static Optional<AK::Array<Label, 2>> side_effect_free_branch_targets(Instruction const& instruction)
+{
+    switch (instruction.type()) {
+    case Instruction::Type::JumpIf: {
+        auto& jump = static_cast<Op::JumpIf const&>(instruction);
+        return AK::Array { jump.true_target(), jump.false_target() };
+    }
+    case Instruction::Type::JumpNullish: {
+        auto& jump = static_cast<Op::JumpNullish const&>(instruction);
+        return AK::Array { jump.true_target(), jump.false_target() };
+    }
+    case Instruction::Type::JumpUndefined: {
+        auto& jump = static_cast<Op::JumpUndefined const&>(instruction);
+        return AK::Array { jump.true_target(), jump.false_target() };
+    }
+    default:
+        return {};
+    }
+}
+
+static Optional<AK::Array<Label, 2>> branch_targets(Instruction const& instruction)
+{
+    if (auto targets = side_effect_free_branch_targets(instruction); targets.has_value())
+        return targets;
+
+    switch (instruction.type()) {
+#define BRANCH_TARGETS(op_TitleCase, ...)                                     \
+    case Instruction::Type::Jump##op_TitleCase: {                             \
+        auto& jump = static_cast<Op::Jump##op_TitleCase const&>(instruction); \
+        return AK::Array { jump.true_target(), jump.false_target() };         \
+    }
+        JS_ENUMERATE_COMPARISON_OPS(BRANCH_TARGETS)
+#undef BRANCH_TARGETS
+    default:
+        return {};
+    }
+}
+
+bool FoldConstantBranches::perform(PassPipelineExecutable& executable) const
+{
+    bool changed = false;
+    for (auto& block : executable.basic_blocks) {
+        if (!block->is_terminated())
+            continue;
+        auto const& terminator = block->terminator();
+
+        auto targets = branch_targets(terminator);
+        if (!targets.has_value())
+            continue;
+
+        Optional<Label> target;
+        if (auto outcome = constant_outcome(terminator, executable.constants); outcome.has_value())
+            target = (*outcome) ? (*targets)[0] : (*targets)[1];
+        else if (side_effect_free_branch_targets(terminator).has_value() && (*targets)[0].basic_block_index() == (*targets)[1].basic_block_index())
+            target = (*targets)[0];
+
+        if (!target.has_value())
+            continue;
+
+        block->replace_terminator<Op::Jump>(*target);
+        changed = true;
+    }
+    return changed;
+}
+
+}
@@ -0,0 +1,73 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <LibJS/Bytecode/Op.h>
+#include <LibJS/Bytecode/PassManager.h>
+
+namespace JS::Bytecode::Passes {
+
+bool RemoveDeadBlocks::perform(PassPipelineExecutable& executable) const
+{
+    auto& blocks = executable.basic_blocks;
+    if (blocks.is_empty())
+        return false;
+
+    // NOTE: Blocks don't fall through into each other, so labels and exception handlers are the only edges.
+    Vector<bool> reachable;
+    reachable.resize(blocks.size());
+    Vector<size_t> worklist;
+    auto mark_reachable = [&](size_t index) {
+        if (reachable[index])
+            return;
+        reachable[index] = true;
+        worklist.append(index);
+    };
+
+    mark_reachable(0);
+    while (!worklist.is_empty()) {
+        auto& block = *blocks[worklist.take_last()];
+        if (block.handler())
+            mark_reachable(block.handler()->index());
+        if (block.finalizer())
+            mark_reachable(block.finalizer()->index());
+        for (InstructionStreamIterator it(block.instruction_stream()); !it.at_end(); ++it) {
+            const_cast<Instruction&>(*it).visit_labels([&](Label& label) {
+                mark_reachable(label.basic_block_index());
+            });
+        }
+    }
+
+    if (!reachable.contains_slow(false))
+        return false;
+
+    Vector<u32> new_indices;
+    new_indices.resize(blocks.size());
+    u32 next_index = 0;
+    for (size_t i = 0; i < blocks.size(); ++i) {
+        if (reachable[i])
+            new_indices[i] = next_index++;
+    }
+
+    Vector<NonnullOwnPtr<BasicBlock>> live_blocks;
+    live_blocks.ensure_capacity(next_index);
+    for (size_t i = 0; i < blocks.size(); ++i) {
+        if (!reachable[i])
+            continue;
+        auto& block = *blocks[i];
+        block.set_index(new_indices[i]);
+        for (InstructionStreamIterator it(block.instruction_stream()); !it.at_end(); ++it) {
+            const_cast<Instruction&>(*it).visit_labels([&](Label& label) {
+                label = Label { new_indices[label.basic_block_index()] };
+            });
+        }
+        live_blocks.unchecked_append(move(blocks[i]));
+    }
+
+    blocks = move(live_blocks);
+    return true;
+}
+
+}
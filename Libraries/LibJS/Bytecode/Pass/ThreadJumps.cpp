@@ -0,0 +1,54 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <LibJS/Bytecode/Op.h>
+#include <LibJS/Bytecode/PassManager.h>
+
+namespace JS::Bytecode::Passes {
+
+bool ThreadJumps::perform(PassPipelineExecutable& executable) const
+{
+    auto& blocks = executable.basic_blocks;
+
+    // For every block that does nothing but jump to another block, the block it jumps to.
+    Vector<Optional<size_t>> forwarded_to;
+    forwarded_to.resize(blocks.size());
+    for (auto& block : blocks) {
+        if (!block->is_terminated())
+            continue;
+        auto const& terminator = block->terminator();
+        if (terminator.type() != Instruction::Type::Jump || terminator.length() != block->size())
+            continue;
+        auto target = static_cast<Op::Jump const&>(terminator).target().basic_block_index();
+        if (target != block->index())
+            forwarded_to[block->index()] = target;
+    }
+
+    auto resolve = [&](size_t index) {
+        // NOTE: Jump-only blocks may jump to each other in a cycle (e.g. `for (;;) {}`). Any block on such a cycle
+        //       behaves the same, so stop once every block could have been visited.
+        for (size_t steps = 0; forwarded_to[index].has_value() && steps < blocks.size(); ++steps)
+            index = *forwarded_to[index];
+        return index;
+    };
+
+    bool changed = false;
+    for (auto& block : blocks) {
+        for (InstructionStreamIterator it(block->instruction_stream()); !it.at_end(); ++it) {
+            auto& instruction = const_cast<Instruction&>(*it);
+            instruction.visit_labels([&](Label& label) {
+                auto target = resolve(label.basic_block_index());
+                if (target == label.basic_block_index())
+                    return;
+                label = Label { static_cast<u32>(target) };
+                changed = true;
+            });
+        }
+    }
+    return changed;
+}
+
+}
@@ -0,0 +1,87 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/Time.h>
+#include <LibJS/Bytecode/PassManager.h>
+
+namespace JS::Bytecode {
+
+bool g_optimize_bytecode = true;
+bool g_dump_bytecode_passes = false;
+
+// Some passes take more than linear time. Executables this large are usually generated or bundled top-level code that runs
+// once, so they skip the pipeline instead of making every page that loads them compile noticeably slower.
+static constexpr size_t max_optimized_bytecode_size = 1 * MiB;
+
+struct PipelineStatistics {
+    size_t basic_block_count { 0 };
+    size_t instruction_count { 0 };
+    u32 register_count { 0 };
+
+    static PipelineStatistics of(PassPipelineExecutable const& executable)
+    {
+        PipelineStatistics statistics;
+        statistics.basic_block_count = executable.basic_blocks.size();
+        statistics.register_count = executable.number_of_registers;
+        for (auto& block : executable.basic_blocks) {
+            for (InstructionStreamIterator it(block->instruction_stream()); !it.at_end(); ++it)
+                ++statistics.instruction_count;
+        }
+        return statistics;
+    }
+};
+
+void PassManager::perform(PassPipelineExecutable& executable) const
+{
+    size_t bytecode_size = 0;
+    for (auto& block : executable.basic_blocks)
+        bytecode_size += block->size();
+    if (bytecode_size > max_optimized_bytecode_size) {
+        if (g_dump_bytecode_passes)
+            warnln("Skipping optimization passes for {} bytes of bytecode", bytecode_size);
+        return;
+    }
+
+    if (!g_dump_bytecode_passes) {
+        for (auto& pass : m_passes)
+            pass->perform(executable);
+        return;
+    }
+
+    for (auto& pass : m_passes) {
+        auto before = PipelineStatistics::of(executable);
+        auto start = MonotonicTime::now();
+        auto changed = pass->perform(executable);
+        auto elapsed = MonotonicTime::now() - start;
+        if (!changed)
+            continue;
+        auto after = PipelineStatistics::of(executable);
+        warnln("\033[37;1m{}\033[0m: blocks {} -> {}, instructions {} -> {}, registers {} -> {} ({}us)",
+            pass->name(),
+            before.basic_block_count, after.basic_block_count,
+            before.instruction_count, after.instruction_count,
+            before.register_count, after.register_count,
+            elapsed.to_microseconds());
+    }
+}
+
+PassManager const& PassManager::default_pipeline()
+{
+    static PassManager const pipeline = [] {
+        PassManager pipeline;
+        // NOTE: Threading jumps first lets branch folding see conditional jumps whose targets became identical.
+        //       Both leave blocks behind that nothing jumps to anymore, which is why dead blocks are removed next.
+        pipeline.add<Passes::ThreadJumps>();
+        pipeline.add<Passes::FoldConstantBranches>();
+        pipeline.add<Passes::RemoveDeadBlocks>();
+        pipeline.add<Passes::EliminateRedundantMoves>();
+        pipeline.add<Passes::CoalesceRegisters>();
+        return pipeline;
+    }();
+    return pipeline;
+}
+
+}
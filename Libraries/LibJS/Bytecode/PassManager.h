@@ -0,0 +1,97 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/NonnullOwnPtr.h>
+#include <AK/Vector.h>
+#include <LibGC/RootVector.h>
+#include <LibJS/Bytecode/BasicBlock.h>
+#include <LibJS/Export.h>
+#include <LibJS/Runtime/Value.h>
+
+namespace JS::Bytecode {
+
+JS_API extern bool g_optimize_bytecode;
+JS_API extern bool g_dump_bytecode_passes;
+
+// The not-yet-linked output of Generator that optimization passes operate on.
+// Operand indices are still relative to their own kind (register, constant, local, argument),
+// and labels still refer to basic block indices.
+struct PassPipelineExecutable {
+    Vector<NonnullOwnPtr<BasicBlock>>& basic_blocks;
+    GC::RootVector<Value> const& constants;
+    u32& number_of_registers;
+};
+
+class Pass {
+public:
+    virtual ~Pass() = default;
+
+    virtual StringView name() const = 0;
+
+    // Returns true if the pass changed anything.
+    virtual bool perform(PassPipelineExecutable&) const = 0;
+};
+
+class PassManager {
+public:
+    template<typename PassType, typename... Args>
+    void add(Args&&... args)
+    {
+        m_passes.append(make<PassType>(forward<Args>(args)...));
+    }
+
+    void perform(PassPipelineExecutable&) const;
+
+    // The passes run on every executable before it is linked.
+    static PassManager const& default_pipeline();
+
+private:
+    Vector<NonnullOwnPtr<Pass>> m_passes;
+};
+
+namespace Passes {
+
+// Folds conditional jumps whose outcome is known at compile time (constant conditions, identical targets) into plain jumps.
+class FoldConstantBranches final : public Pass {
+public:
+    virtual StringView name() const override { return "FoldConstantBranches"sv; }
+    virtual bool perform(PassPipelineExecutable&) const override;
+};
+
+// Retargets labels that point at blocks consisting of nothing but an unconditional jump.
+class ThreadJumps final : public Pass {
+public:
+    virtual StringView name() const override { return "ThreadJumps"sv; }
+    virtual bool perform(PassPipelineExecutable&) const override;
+};
+
+// Removes blocks that can't be reached from the entry block, and renumbers the remaining ones.
+class RemoveDeadBlocks final : public Pass {
+public:
+    virtual StringView name() const override { return "RemoveDeadBlocks"sv; }
+    virtual bool perform(PassPipelineExecutable&) const override;
+};
+
+// Removes moves that have no observable effect: self-moves, moves that are immediately overwritten,
+// and moves that copy a value straight back to where it came from.
+class EliminateRedundantMoves final : public Pass {
+public:
+    virtual StringView name() const override { return "EliminateRedundantMoves"sv; }
+    virtual bool perform(PassPipelineExecutable&) const override;
+};
+
+// Renumbers registers so that registers with disjoint live ranges share a slot, shrinking the register file.
+class CoalesceRegisters final : public Pass {
+public:
+    virtual StringView name() const override { return "CoalesceRegisters"sv; }
+    virtual bool perform(PassPipelineExecutable&) const override;
+};
+
+}
+
+}
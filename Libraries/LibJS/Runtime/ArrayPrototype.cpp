@@ -109,6 +109,42 @@ void ArrayPrototype::initialize(Realm& realm)
     define_direct_property(vm.well_known_symbol_unscopables(), unscopable_list, Attribute::Configurable);
 }
 
+// OPTIMIZATION: The elements of an Array whose storage has no holes and only holds numbers are all own data properties,
+//               so searching them can't reach the prototype chain or run user code, and we can read them directly.
+struct PackedNumberElements {
+    ReadonlySpan<Value> elements;
+    ElementKind kind;
+};
+
+static Optional<PackedNumberElements> packed_number_elements(Object const& object, u64 length)
+{
+    auto const* array = as_if<Array>(object);
+    if (!array)
+        return {};
+    auto const& indexed_properties = array->indexed_properties();
+    auto kind = indexed_properties.element_kind();
+    if (kind != ElementKind::PackedInt32 && kind != ElementKind::PackedDouble)
+        return {};
+    auto const& simple_storage = static_cast<SimpleIndexedPropertyStorage const&>(*indexed_properties.storage());
+    if (simple_storage.array_like_size() != length)
+        return {};
+    return PackedNumberElements { simple_storage.elements().span().trim(length), kind };
+}
+
+// NOTE: PackedInt32 elements are never NaN or -0, so a number matches one of them under both IsStrictlyEqual and
+//       SameValueZero exactly when it is the same integer (with -0 matching 0). Other numbers can't match anything.
+static Optional<i32> int32_search_element(Value search_element)
+{
+    if (search_element.is_int32())
+        return search_element.as_i32();
+    if (!search_element.is_integral_number())
+        return {};
+    auto number = search_element.as_double();
+    if (number < NumericLimits<i32>::min() || number > NumericLimits<i32>::max())
+        return {};
+    return static_cast<i32>(number);
+}
+
 // 10.4.2.3 ArraySpeciesCreate ( originalArray, length ), https://tc39.es/ecma262/#sec-arrayspeciescreate
 static ThrowCompletionOr<Object*> array_species_create(VM& vm, Object& original_array, size_t length)
 {
@@ -742,6 +778,25 @@ JS_DEFINE_NATIVE_FUNCTION(ArrayPrototype::includes)
             from_index = from_argument;
     }
     auto value_to_find = vm.argument(0);
+    if (auto packed = packed_number_elements(*this_object, length); packed.has_value()) {
+        if (!value_to_find.is_number())
+            return Value(false);
+        if (packed->kind == ElementKind::PackedInt32) {
+            auto int32_to_find = int32_search_element(value_to_find);
+            if (!int32_to_find.has_value())
+                return Value(false);
+            for (u64 i = from_index; i < length; ++i) {
+                if (packed->elements[i].as_i32() == *int32_to_find)
+                    return Value(true);
+            }
+            return Value(false);
+        }
+        for (u64 i = from_index; i < length; ++i) {
+            if (same_value_zero(packed->elements[i], value_to_find))
+                return Value(true);
+        }
+        return Value(false);
+    }
     for (u64 i = from_index; i < length; ++i) {
         auto element = TRY(this_object->get(i));
         if (same_value_zero(element, value_to_find))
@@ -795,6 +850,26 @@ JS_DEFINE_NATIVE_FUNCTION(ArrayPrototype::index_of)
         k = max(length + n, 0);
     }
 
+    if (auto packed = packed_number_elements(*object, length); packed.has_value()) {
+        if (!search_element.is_number())
+            return Value(-1);
+        if (packed->kind == ElementKind::PackedInt32) {
+            auto int32_search = int32_search_element(search_element);
+            if (!int32_search.has_value())
+                return Value(-1);
+            for (; k < length; ++k) {
+                if (packed->elements[k].as_i32() == *int32_search)
+                    return Value(k);
+            }
+            return Value(-1);
+        }
+        for (; k < length; ++k) {
+            if (is_strictly_equal(search_element, packed->elements[k]))
+                return Value(k);
+        }
+        return Value(-1);
+    }
+
     // 10. Repeat, while k < len,
     for (; k < length; ++k) {
         auto property_key = PropertyKey { k };
@@ -906,6 +981,26 @@ JS_DEFINE_NATIVE_FUNCTION(ArrayPrototype::last_index_of)
         k = (double)length + n;
     }
 
+    if (auto packed = packed_number_elements(*object, length); packed.has_value()) {
+        if (!search_element.is_number())
+            return Value(-1);
+        if (packed->kind == ElementKind::PackedInt32) {
+            auto int32_search = int32_search_element(search_element);
+            if (!int32_search.has_value())
+                return Value(-1);
+            for (; k >= 0; --k) {
+                if (packed->elements[k].as_i32() == *int32_search)
+                    return Value((size_t)k);
+            }
+            return Value(-1);
+        }
+        for (; k >= 0; --k) {
+            if (is_strictly_equal(search_element, packed->elements[k]))
+                return Value((size_t)k);
+        }
+        return Value(-1);
+    }
+
     // 8. Repeat, while k ≥ 0,
     for (; k >= 0; --k) {
         auto property_key = PropertyKey { k };
@@ -59,7 +59,7 @@ GC::Ref<ECMAScriptFunctionObject> ECMAScriptFunctionObject::create(Realm& realm,
         function_length,
         *parameters,
         ecmascript_code,
-        source_text,
+        move(source_text),
         is_strict,
         is_arrow_function,
         parsing_insights,
@@ -83,7 +83,7 @@ GC::Ref<ECMAScriptFunctionObject> ECMAScriptFunctionObject::create(Realm& realm,
         function_length,
         *parameters,
         ecmascript_code,
-        source_text,
+        move(source_text),
         is_strict,
         is_arrow_function,
         parsing_insights,
@@ -128,7 +128,7 @@ GC::Ref<ECMAScriptFunctionObject> ECMAScriptFunctionObject::create_from_function
             function_node.function_length(),
             function_node.parameters(),
             *function_node.body_ptr(),
-            function_node.source_text(),
+            function_node.source_text_range(),
             function_node.is_strict_mode(),
             function_node.is_arrow_function(),
             function_node.parsing_insights(),
@@ -150,7 +150,7 @@ SharedFunctionInstanceData::SharedFunctionInstanceData(
     i32 function_length,
     NonnullRefPtr<FunctionParameters const> formal_parameters,
     NonnullRefPtr<Statement const> ecmascript_code,
-    ByteString source_text,
+    Variant<UnrealizedSourceRange, ByteString> source_text,
     bool strict,
     bool is_arrow_function,
     FunctionParsingInsights const& parsing_insights,
@@ -420,6 +420,13 @@ SharedFunctionInstanceData::SharedFunctionInstanceData(
     m_function_environment_needed = arguments_object_needs_binding || m_function_environment_bindings_count > 0 || m_var_environment_bindings_count > 0 || m_lex_environment_bindings_count > 0 || parsing_insights.uses_this_from_environment || m_contains_direct_call_to_eval;
 }
 
+ByteString const& SharedFunctionInstanceData::source_text() const
+{
+    if (auto* unrealized = m_source_text.get_pointer<UnrealizedSourceRange>())
+        m_source_text = unrealized->source_text();
+    return m_source_text.get<ByteString>();
+}
+
 ECMAScriptFunctionObject::ECMAScriptFunctionObject(
     NonnullRefPtr<SharedFunctionInstanceData> shared_data,
     Environment* parent_environment,
@@ -548,6 +555,26 @@ FLATTEN ThrowCompletionOr<Value> ECMAScriptFunctionObject::internal_call(Executi
     return result;
 }
 
+// NOTE: This is internal_call() without step 4, for the call site caches in the bytecode interpreter.
+FLATTEN ThrowCompletionOr<Value> ECMAScriptFunctionObject::call_non_class_constructor(ExecutionContext& callee_context, Value this_argument)
+{
+    auto& vm = this->vm();
+
+    ASSERT(m_bytecode_executable);
+    ASSERT(!is_class_constructor());
+
+    prepare_for_ordinary_call(vm, callee_context, nullptr);
+
+    if (uses_this())
+        ordinary_call_bind_this(vm, callee_context, this_argument);
+
+    auto result = ordinary_call_evaluate_body(vm);
+
+    vm.pop_execution_context();
+
+    return result;
+}
+
 // 10.2.2 [[Construct]] ( argumentsList, newTarget ), https://tc39.es/ecma262/#sec-ecmascript-function-objects-construct-argumentslist-newtarget
 ThrowCompletionOr<GC::Ref<Object>> ECMAScriptFunctionObject::internal_construct(ExecutionContext& callee_context, FunctionObject& new_target)
 {
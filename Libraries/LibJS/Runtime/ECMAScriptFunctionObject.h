@@ -14,6 +14,7 @@
 #include <LibJS/Runtime/ClassFieldDefinition.h>
 #include <LibJS/Runtime/ExecutionContext.h>
 #include <LibJS/Runtime/FunctionObject.h>
+#include <LibJS/SourceRange.h>
 
 namespace JS {
 
@@ -43,7 +44,7 @@ public:
         i32 function_length,
         NonnullRefPtr<FunctionParameters const>,
         NonnullRefPtr<Statement const> ecmascript_code,
-        ByteString source_text,
+        Variant<UnrealizedSourceRange, ByteString> source_text,
         bool strict,
         bool is_arrow_function,
         FunctionParsingInsights const&,
@@ -52,8 +53,12 @@ public:
     RefPtr<FunctionParameters const> m_formal_parameters; // [[FormalParameters]]
     RefPtr<Statement const> m_ecmascript_code;            // [[ECMAScriptCode]]
 
+    ByteString const& source_text() const;
+
     Utf16FlyString m_name;
-    ByteString m_source_text; // [[SourceText]]
+
+    // NOTE: This is lazily realized into a ByteString the first time someone asks for it.
+    mutable Variant<UnrealizedSourceRange, ByteString> m_source_text; // [[SourceText]]
 
     Vector<LocalVariable> m_local_variables_names;
 
@@ -121,6 +126,9 @@ public:
     virtual ThrowCompletionOr<Value> internal_call(ExecutionContext&, Value this_argument) override;
     virtual ThrowCompletionOr<GC::Ref<Object>> internal_construct(ExecutionContext&, FunctionObject& new_target) override;
 
+    // [[Call]] for callers that already know this isn't a class constructor and have called get_stack_frame_size().
+    ThrowCompletionOr<Value> call_non_class_constructor(ExecutionContext&, Value this_argument);
+
     void make_method(Object& home_object);
 
     [[nodiscard]] bool is_module_wrapper() const { return shared_data().m_is_module_wrapper; }
@@ -151,8 +159,8 @@ public:
     Object* home_object() const { return m_home_object; }
     void set_home_object(Object* home_object) { m_home_object = home_object; }
 
-    [[nodiscard]] ByteString const& source_text() const { return shared_data().m_source_text; }
-    void set_source_text(ByteString source_text) { const_cast<SharedFunctionInstanceData&>(shared_data()).m_source_text = move(source_text); }
+    [[nodiscard]] ByteString const& source_text() const { return shared_data().source_text(); }
+    void set_source_text(Variant<UnrealizedSourceRange, ByteString> source_text) { const_cast<SharedFunctionInstanceData&>(shared_data()).m_source_text = move(source_text); }
 
     Vector<ClassFieldDefinition> const& fields() const { return ensure_class_data().fields; }
     void add_field(ClassFieldDefinition field) { ensure_class_data().fields.append(move(field)); }
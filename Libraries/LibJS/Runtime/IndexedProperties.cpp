@@ -17,6 +17,12 @@ SimpleIndexedPropertyStorage::SimpleIndexedPropertyStorage(Vector<Value>&& initi
     : IndexedPropertyStorage(IsSimpleStorage::Yes, initial_values.size())
     , m_packed_elements(move(initial_values))
 {
+    for (auto value : m_packed_elements) {
+        if (value.is_special_empty_value())
+            ++m_number_of_empty_elements;
+        else
+            widen_value_kind(value);
+    }
 }
 
 bool SimpleIndexedPropertyStorage::has_index(u32 index) const
@@ -59,6 +65,7 @@ void SimpleIndexedPropertyStorage::put(u32 index, Value value, PropertyAttribute
     if (value.is_special_empty_value()) {
         ++m_number_of_empty_elements;
     }
+    widen_value_kind(value);
 }
 
 void SimpleIndexedPropertyStorage::remove(u32 index)
@@ -97,6 +104,10 @@ bool SimpleIndexedPropertyStorage::set_array_like_size(size_t new_size)
     m_array_size = new_size;
     m_packed_elements.resize_with_default_value_and_keep_capacity(new_size, js_special_empty_value());
 
+    // NOTE: Once every element is gone, the storage can start over with the narrowest kind.
+    if (new_size == 0)
+        m_value_kind = ElementKind::PackedInt32;
+
     if (old_size <= m_array_size) {
         m_number_of_empty_elements += m_array_size - old_size;
     } else {
@@ -20,6 +20,16 @@ struct ValueAndAttributes {
     Optional<u32> property_offset {};
 };
 
+// Summarizes the elements of an object's indexed properties, so that hot paths can skip per-element checks.
+// Kinds only ever widen as values are stored: PackedInt32 -> PackedDouble -> Packed. Any hole makes the kind Holey.
+enum class ElementKind : u8 {
+    PackedInt32,
+    PackedDouble,
+    Packed,
+    Holey,
+    Generic,
+};
+
 class IndexedProperties;
 class IndexedPropertyIterator;
 class GenericIndexedPropertyStorage;
@@ -95,12 +105,28 @@ public:
 
     bool has_empty_elements() const { return m_number_of_empty_elements.value() > 0; }
 
+    ElementKind element_kind() const { return has_empty_elements() ? ElementKind::Holey : m_value_kind; }
+    bool holds_only_numbers() const { return m_value_kind != ElementKind::Packed; }
+    bool holds_only_packed_numbers() const { return holds_only_numbers() && !has_empty_elements(); }
+
 private:
     friend GenericIndexedPropertyStorage;
 
     void grow_storage_if_needed();
 
+    void widen_value_kind(Value value)
+    {
+        if (m_value_kind == ElementKind::Packed || value.is_int32())
+            return;
+        if (value.is_number())
+            m_value_kind = ElementKind::PackedDouble;
+        else if (!value.is_special_empty_value())
+            m_value_kind = ElementKind::Packed;
+    }
+
     Checked<size_t> m_number_of_empty_elements { 0 };
+    // NOTE: This is the kind the elements would have without their holes, so it is never Holey or Generic.
+    ElementKind m_value_kind { ElementKind::PackedInt32 };
     Vector<Value> m_packed_elements;
 };
 
@@ -178,6 +204,15 @@ public:
     IndexedPropertyStorage* storage() { return m_storage; }
     IndexedPropertyStorage const* storage() const { return m_storage; }
 
+    ElementKind element_kind() const
+    {
+        if (!m_storage)
+            return ElementKind::PackedInt32;
+        if (!m_storage->is_simple_storage())
+            return ElementKind::Generic;
+        return static_cast<SimpleIndexedPropertyStorage const&>(*m_storage).element_kind();
+    }
+
     size_t real_size() const;
 
     Vector<u32> indices() const;
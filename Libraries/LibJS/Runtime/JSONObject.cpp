@@ -4,11 +4,15 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <AK/CharacterTypes.h>
 #include <AK/Function.h>
+#include <AK/GenericLexer.h>
+#include <AK/HashMap.h>
 #include <AK/JsonArray.h>
 #include <AK/JsonObject.h>
 #include <AK/JsonParser.h>
 #include <AK/StringBuilder.h>
+#include <AK/StringConversions.h>
 #include <AK/TypeCasts.h>
 #include <AK/Utf16View.h>
 #include <AK/Utf8View.h>
@@ -447,21 +451,318 @@ JS_DEFINE_NATIVE_FUNCTION(JSONObject::parse)
     return unfiltered;
 }
 
+// OPTIMIZATION: This parses JSON text straight into JS values, rather than building an AK::JsonValue tree first and
+//               then converting that into JS objects, which allocated everything twice.
+class JSONParser {
+public:
+    JSONParser(VM& vm, StringView text)
+        : m_vm(vm)
+        , m_realm(*vm.current_realm())
+        , m_lexer(text)
+    {
+    }
+
+    ThrowCompletionOr<Value> parse()
+    {
+        auto value = TRY(parse_value());
+        m_lexer.ignore_while(is_json_whitespace);
+        if (!m_lexer.is_eof())
+            return malformed();
+        return value;
+    }
+
+private:
+    static constexpr bool is_json_whitespace(char ch)
+    {
+        return ch == '\t' || ch == '\n' || ch == '\r' || ch == ' ';
+    }
+
+    Completion malformed() const
+    {
+        return m_vm.throw_completion<SyntaxError>(ErrorType::JsonMalformed);
+    }
+
+    ThrowCompletionOr<Value> parse_value()
+    {
+        m_lexer.ignore_while(is_json_whitespace);
+
+        switch (m_lexer.peek()) {
+        case '{':
+            return parse_object();
+        case '[':
+            return parse_array();
+        case '"':
+            return parse_string();
+        case 't':
+            if (m_lexer.consume_specific("true"sv))
+                return Value(true);
+            return malformed();
+        case 'f':
+            if (m_lexer.consume_specific("false"sv))
+                return Value(false);
+            return malformed();
+        case 'n':
+            if (m_lexer.consume_specific("null"sv))
+                return js_null();
+            return malformed();
+        case '-':
+        case '0':
+        case '1':
+        case '2':
+        case '3':
+        case '4':
+        case '5':
+        case '6':
+        case '7':
+        case '8':
+        case '9':
+            return parse_number();
+        default:
+            return malformed();
+        }
+    }
+
+    ThrowCompletionOr<Value> parse_object()
+    {
+        if (m_vm.did_reach_stack_space_limit())
+            return m_vm.throw_completion<InternalError>(ErrorType::CallStackSizeExceeded);
+
+        m_lexer.ignore(); // '{'
+
+        // NOTE: Objects created from the same set of keys end up sharing shapes through the regular put transitions.
+        auto object = Object::create(m_realm, m_realm.intrinsics().object_prototype());
+
+        m_lexer.ignore_while(is_json_whitespace);
+        if (m_lexer.consume_specific('}'))
+            return object;
+
+        for (;;) {
+            m_lexer.ignore_while(is_json_whitespace);
+            if (!m_lexer.next_is('"'))
+                return malformed();
+
+            auto key = TRY(parse_property_key());
+
+            m_lexer.ignore_while(is_json_whitespace);
+            if (!m_lexer.consume_specific(':'))
+                return malformed();
+
+            auto value = TRY(parse_value());
+            object->define_direct_property(key, value, default_attributes);
+
+            m_lexer.ignore_while(is_json_whitespace);
+            if (m_lexer.consume_specific('}'))
+                return object;
+            if (!m_lexer.consume_specific(','))
+                return malformed();
+        }
+    }
+
+    ThrowCompletionOr<Value> parse_array()
+    {
+        if (m_vm.did_reach_stack_space_limit())
+            return m_vm.throw_completion<InternalError>(ErrorType::CallStackSizeExceeded);
+
+        m_lexer.ignore(); // '['
+
+        auto array = MUST(Array::create(m_realm, 0));
+
+        m_lexer.ignore_while(is_json_whitespace);
+        if (m_lexer.consume_specific(']'))
+            return array;
+
+        for (;;) {
+            auto value = TRY(parse_value());
+            array->indexed_properties().append(value);
+
+            m_lexer.ignore_while(is_json_whitespace);
+            if (m_lexer.consume_specific(']'))
+                return array;
+            if (!m_lexer.consume_specific(','))
+                return malformed();
+        }
+    }
+
+    ThrowCompletionOr<Value> parse_string()
+    {
+        auto string = TRY(consume_string());
+
+        return string.visit(
+            [&](StringView utf8_string) -> Value { return PrimitiveString::create(m_vm, utf8_string); },
+            [&](Utf16String const& utf16_string) -> Value { return PrimitiveString::create(m_vm, utf16_string); });
+    }
+
+    ThrowCompletionOr<PropertyKey> parse_property_key()
+    {
+        auto string = TRY(consume_string());
+
+        if (auto* utf16_string = string.get_pointer<Utf16String>())
+            return PropertyKey { *utf16_string };
+
+        // OPTIMIZATION: Objects in a JSON text tend to repeat the same keys over and over, so we only convert and intern
+        //               each distinct key once.
+        auto utf8_string = string.get<StringView>();
+        return m_property_key_cache.ensure(utf8_string, [&] {
+            return PropertyKey { Utf16FlyString::from_utf8(utf8_string) };
+        });
+    }
+
+    // Returns a view into the JSON text if the string contains no escape sequences, and the unescaped string otherwise.
+    ThrowCompletionOr<Variant<StringView, Utf16String>> consume_string()
+    {
+        m_lexer.ignore(); // '"'
+        auto start = m_lexer.tell();
+
+        for (;;) {
+            auto ch = m_lexer.peek();
+
+            // NOTE: peek() returns 0 at the end of the input, which is also caught here.
+            if (is_ascii_c0_control(ch))
+                return malformed();
+            if (ch == '\\')
+                break;
+            if (ch == '"') {
+                auto string = m_lexer.input().substring_view(start, m_lexer.tell() - start);
+                m_lexer.ignore();
+                return string;
+            }
+
+            m_lexer.ignore();
+        }
+
+        StringBuilder builder(StringBuilder::Mode::UTF16);
+        builder.append(m_lexer.input().substring_view(start, m_lexer.tell() - start));
+
+        for (;;) {
+            auto ch = m_lexer.peek();
+
+            if (is_ascii_c0_control(ch))
+                return malformed();
+            if (ch == '"') {
+                m_lexer.ignore();
+                return builder.to_utf16_string();
+            }
+            if (ch != '\\') {
+                auto literal_start = m_lexer.tell();
+                m_lexer.ignore_while([](char character) { return character != '"' && character != '\\' && !is_ascii_c0_control(character); });
+                builder.append(m_lexer.input().substring_view(literal_start, m_lexer.tell() - literal_start));
+                continue;
+            }
+
+            m_lexer.ignore(); // '\'
+
+            switch (m_lexer.peek()) {
+            case '"':
+            case '\\':
+            case '/':
+                builder.append_code_unit(m_lexer.consume());
+                break;
+            case 'b':
+                m_lexer.ignore();
+                builder.append_code_unit('\b');
+                break;
+            case 'f':
+                m_lexer.ignore();
+                builder.append_code_unit('\f');
+                break;
+            case 'n':
+                m_lexer.ignore();
+                builder.append_code_unit('\n');
+                break;
+            case 'r':
+                m_lexer.ignore();
+                builder.append_code_unit('\r');
+                break;
+            case 't':
+                m_lexer.ignore();
+                builder.append_code_unit('\t');
+                break;
+            case 'u': {
+                m_lexer.ignore();
+
+                // NOTE: Each escape is a single UTF-16 code unit, so surrogate pairs written as two escapes combine
+                //       naturally, and lone surrogates are preserved as the spec requires.
+                char16_t code_unit = 0;
+                for (size_t i = 0; i < 4; ++i) {
+                    if (!m_lexer.next_is(is_ascii_hex_digit))
+                        return malformed();
+                    code_unit = (code_unit << 4) | parse_ascii_hex_digit(m_lexer.consume());
+                }
+
+                builder.append_code_unit(code_unit);
+                break;
+            }
+            default:
+                return malformed();
+            }
+        }
+    }
+
+    ThrowCompletionOr<Value> parse_number()
+    {
+        auto start = m_lexer.tell();
+        auto is_negative = m_lexer.consume_specific('-');
+
+        if (!m_lexer.consume_specific('0')) {
+            if (!m_lexer.next_is(is_ascii_digit))
+                return malformed();
+            m_lexer.ignore_while(is_ascii_digit);
+        }
+
+        auto is_integer = true;
+
+        if (m_lexer.consume_specific('.')) {
+            if (!m_lexer.next_is(is_ascii_digit))
+                return malformed();
+            m_lexer.ignore_while(is_ascii_digit);
+            is_integer = false;
+        }
+
+        if (m_lexer.consume_specific('e') || m_lexer.consume_specific('E')) {
+            if (!m_lexer.consume_specific('+'))
+                m_lexer.consume_specific('-');
+            if (!m_lexer.next_is(is_ascii_digit))
+                return malformed();
+            m_lexer.ignore_while(is_ascii_digit);
+            is_integer = false;
+        }
+
+        auto number_text = m_lexer.input().substring_view(start, m_lexer.tell() - start);
+
+        // OPTIMIZATION: Most numbers in JSON texts are small integers, which we can compute exactly without going
+        //               through the floating point parser.
+        if (auto digits = number_text.substring_view(is_negative ? 1 : 0); is_integer && digits.length() <= 15) {
+            i64 value = 0;
+            for (auto digit : digits)
+                value = (value * 10) + (digit - '0');
+
+            if (is_negative)
+                return Value(value == 0 ? -0.0 : -static_cast<double>(value));
+            return Value(static_cast<double>(value));
+        }
+
+        auto value = AK::parse_number<double>(number_text, TrimWhitespace::No);
+        if (!value.has_value())
+            return malformed();
+        return Value(*value);
+    }
+
+    VM& m_vm;
+    Realm& m_realm;
+    GenericLexer m_lexer;
+    HashMap<StringView, PropertyKey> m_property_key_cache;
+};
+
 // 25.5.1.1 ParseJSON ( text ), https://tc39.es/ecma262/#sec-ParseJSON
 ThrowCompletionOr<Value> JSONObject::parse_json(VM& vm, StringView text)
 {
-    auto json = JsonValue::from_string(text);
-
     // 1. If StringToCodePoints(text) is not a valid JSON text as specified in ECMA-404, throw a SyntaxError exception.
-    if (json.is_error())
-        return vm.throw_completion<SyntaxError>(ErrorType::JsonMalformed);
-
     // 2. Let scriptString be the string-concatenation of "(", text, and ");".
     // 3. Let script be ParseText(scriptString, Script).
     // 4. NOTE: The early error rules defined in 13.2.5.1 have special handling for the above invocation of ParseText.
     // 5. Assert: script is a Parse Node.
     // 6. Let result be ! Evaluation of script.
-    auto result = JSONObject::parse_json_value(vm, json.value());
+    auto result = TRY(JSONParser(vm, text).parse());
 
     // 7. NOTE: The PropertyDefinitionEvaluation semantics defined in 13.2.5.5 have special handling for the above evaluation.
     // 8. Assert: result is either a String, a Number, a Boolean, an Object that is defined by either an ArrayLiteral or an ObjectLiteral, or null.
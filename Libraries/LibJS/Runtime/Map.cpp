@@ -4,12 +4,15 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <AK/BinarySearch.h>
 #include <LibJS/Runtime/Map.h>
 
 namespace JS {
 
 GC_DEFINE_ALLOCATOR(Map);
 
+static constexpr size_t minimum_bucket_count = 8;
+
 GC::Ref<Map> Map::create(Realm& realm)
 {
     return realm.create<Map>(realm.intrinsics().map_prototype());
@@ -23,71 +26,151 @@ Map::Map(Object& prototype)
 // 24.1.3.1 Map.prototype.clear ( ), https://tc39.es/ecma262/#sec-map.prototype.clear
 void Map::map_clear()
 {
-    m_keys.clear();
     m_entries.clear();
+    m_buckets.clear();
+    m_deleted_count = 0;
+    ++m_compaction_generation;
 }
 
 // 24.1.3.3 Map.prototype.delete ( key ), https://tc39.es/ecma262/#sec-map.prototype.delete
 bool Map::map_remove(Value const& key)
 {
-    Optional<size_t> index;
-
-    for (auto it = m_keys.begin(); !it.is_end(); ++it) {
-        if (ValueTraits::equals(*it, key)) {
-            index = it.key();
-            break;
-        }
-    }
-
+    auto index = find_entry_index(key, ValueTraits::hash(key));
     if (!index.has_value())
         return false;
 
-    m_keys.remove(*index);
-    m_entries.remove(key);
+    auto& entry = m_entries[*index];
+    entry.key = js_special_empty_value();
+    entry.value = js_undefined();
+    ++m_deleted_count;
+
+    // NOTE: Give the memory held by tombstones back once they make up most of the table.
+    if (m_deleted_count > m_entries.size() / 2 && m_entries.size() >= minimum_bucket_count) {
+        rehash(m_buckets.size());
+        m_entries.shrink_to_fit();
+    }
+
     return true;
 }
 
 // 24.1.3.6 Map.prototype.get ( key ), https://tc39.es/ecma262/#sec-map.prototype.get
 Optional<Value> Map::map_get(Value const& key) const
 {
-    if (auto it = m_entries.find(key); it != m_entries.end())
-        return it->value;
+    if (auto index = find_entry_index(key, ValueTraits::hash(key)); index.has_value())
+        return m_entries[*index].value;
     return {};
 }
 
 // 24.1.3.7 Map.prototype.has ( key ), https://tc39.es/ecma262/#sec-map.prototype.has
 bool Map::map_has(Value const& key) const
 {
-    return m_entries.contains(key);
+    return find_entry_index(key, ValueTraits::hash(key)).has_value();
 }
 
 // 24.1.3.9 Map.prototype.set ( key, value ), https://tc39.es/ecma262/#sec-map.prototype.set
 void Map::map_set(Value const& key, Value value)
 {
-    auto it = m_entries.find(key);
-    if (it != m_entries.end()) {
-        it->value = value;
-    } else {
-        auto index = m_next_insertion_id++;
-        m_keys.insert(index, key);
-        m_entries.set(key, value);
+    auto hash = ValueTraits::hash(key);
+
+    if (auto index = find_entry_index(key, hash); index.has_value()) {
+        m_entries[*index].value = value;
+        return;
     }
+
+    // NOTE: We keep the number of entries (including tombstones) at most twice the number of buckets.
+    if (m_entries.size() >= m_buckets.size() * 2) {
+        auto live_count = m_entries.size() - m_deleted_count;
+        auto bucket_count = max(m_buckets.size(), minimum_bucket_count);
+        if (live_count >= bucket_count)
+            bucket_count *= 2;
+        rehash(bucket_count);
+    }
+
+    auto& bucket = m_buckets[hash & (m_buckets.size() - 1)];
+    m_entries.append({
+        .key = key,
+        .value = value,
+        .insertion_id = m_next_insertion_id++,
+        .hash = hash,
+        .next_in_bucket = bucket,
+    });
+    bucket = m_entries.size() - 1;
 }
 
 size_t Map::map_size() const
 {
-    return m_keys.size();
+    return m_entries.size() - m_deleted_count;
+}
+
+void Map::copy_entries_from(Map const& other)
+{
+    m_entries = other.m_entries;
+    m_buckets = other.m_buckets;
+    m_deleted_count = other.m_deleted_count;
+    m_next_insertion_id = other.m_next_insertion_id;
+    ++m_compaction_generation;
+}
+
+Optional<size_t> Map::find_entry_index(Value const& key, u32 hash) const
+{
+    if (m_buckets.is_empty())
+        return {};
+
+    for (auto index = m_buckets[hash & (m_buckets.size() - 1)]; index != invalid_entry_index; index = m_entries[index].next_in_bucket) {
+        auto const& entry = m_entries[index];
+        if (entry.hash == hash && !entry.is_deleted() && ValueTraits::equals(entry.key, key))
+            return index;
+    }
+
+    return {};
+}
+
+size_t Map::index_of_first_entry_not_below(size_t insertion_id) const
+{
+    size_t nearby_index = 0;
+    if (binary_search(m_entries, insertion_id, &nearby_index, [](size_t id, Entry const& entry) -> int {
+            if (id < entry.insertion_id)
+                return -1;
+            return id > entry.insertion_id ? 1 : 0;
+        }))
+        return nearby_index;
+
+    if (nearby_index < m_entries.size() && m_entries[nearby_index].insertion_id < insertion_id)
+        ++nearby_index;
+    return nearby_index;
+}
+
+void Map::rehash(size_t bucket_count)
+{
+    VERIFY(is_power_of_two(bucket_count));
+
+    // Drop tombstones. This shifts entry indices, so live iterators are told to find their position again.
+    if (m_deleted_count > 0) {
+        m_entries.remove_all_matching([](auto const& entry) { return entry.is_deleted(); });
+        m_deleted_count = 0;
+        ++m_compaction_generation;
+    }
+
+    m_buckets.clear();
+    m_buckets.resize(bucket_count);
+    m_buckets.fill(invalid_entry_index);
+
+    for (u32 index = 0; index < m_entries.size(); ++index) {
+        auto& bucket = m_buckets[m_entries[index].hash & (bucket_count - 1)];
+        m_entries[index].next_in_bucket = bucket;
+        bucket = index;
+    }
 }
 
 void Map::visit_edges(Cell::Visitor& visitor)
 {
     Base::visit_edges(visitor);
-    for (auto& value : m_entries) {
-        visitor.visit(value.key);
-        visitor.visit(value.value);
+    for (auto const& entry : m_entries) {
+        if (entry.is_deleted())
+            continue;
+        visitor.visit(entry.key);
+        visitor.visit(entry.value);
     }
-    // NOTE: The entries in m_keys are already visited by the walk over m_entries above.
-    visitor.ignore(m_keys);
 }
 
 }
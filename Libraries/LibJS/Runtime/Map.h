@@ -6,8 +6,7 @@
 
 #pragma once
 
-#include <AK/HashMap.h>
-#include <AK/RedBlackTree.h>
+#include <AK/Vector.h>
 #include <LibJS/Export.h>
 #include <LibJS/Runtime/GlobalObject.h>
 #include <LibJS/Runtime/Object.h>
@@ -34,36 +33,52 @@ public:
     void map_set(Value const&, Value);
     size_t map_size() const;
 
+    struct Entry {
+        bool is_deleted() const { return key.is_special_empty_value(); }
+
+        Value key;
+        Value value;
+        size_t insertion_id { 0 };
+        u32 hash { 0 };
+        u32 next_in_bucket { 0 };
+    };
+
     struct EndIterator {
     };
 
+    // NOTE: Iterators remember the insertion id of the next entry they will visit, so they stay valid while entries are
+    //       added or removed. As long as the map hasn't been compacted since the iterator last looked at it, its cached
+    //       entry index is still valid; otherwise it is recomputed with a binary search over the insertion ids.
     template<bool IsConst>
     struct IteratorImpl {
         bool is_end() const
         {
-            return m_map->m_keys.begin_from(m_index).is_end()
-                && m_map->m_keys.find_smallest_not_below_iterator(m_index).is_end();
+            ensure_index();
+            return m_index >= m_map->m_entries.size();
         }
 
         IteratorImpl& operator++()
         {
+            ensure_index();
+            if (m_index < m_map->m_entries.size())
+                m_next_insertion_id = m_map->m_entries[m_index].insertion_id + 1;
             ++m_index;
             return *this;
         }
 
         decltype(auto) operator*()
         {
-            ensure_next_element();
-            return *m_map->m_entries.find(*m_map->m_keys.begin_from(m_index));
+            ensure_index();
+            return m_map->m_entries[m_index];
         }
 
         decltype(auto) operator*() const
         {
-            ensure_next_element();
-            return *m_map->m_entries.find(*m_map->m_keys.begin_from(m_index));
+            ensure_index();
+            return m_map->m_entries[m_index];
         }
 
-        bool operator==(IteratorImpl const& other) const { return m_index == other.m_index && &m_map == &other.m_map; }
+        bool operator==(IteratorImpl const& other) const { return m_next_insertion_id == other.m_next_insertion_id && &m_map == &other.m_map; }
         bool operator==(EndIterator const&) const { return is_end(); }
 
     private:
@@ -71,35 +86,37 @@ public:
         IteratorImpl(Map const& map)
         requires(IsConst)
             : m_map(map)
+            , m_compaction_generation(map.m_compaction_generation)
         {
-            ensure_index();
         }
 
         IteratorImpl(Map& map)
         requires(!IsConst)
             : m_map(map)
+            , m_compaction_generation(map.m_compaction_generation)
         {
-            ensure_index();
         }
 
         void ensure_index() const
         {
-            if (m_map->m_keys.is_empty())
-                m_index = m_map->m_next_insertion_id;
-            else
-                m_index = m_map->m_keys.begin().key();
-        }
+            auto const& entries = m_map->m_entries;
 
-        void ensure_next_element() const
-        {
-            if (auto it = m_map->m_keys.find_smallest_not_below_iterator(m_index); it.is_end())
-                m_index = m_map->m_next_insertion_id;
-            else
-                m_index = it.key();
+            if (m_compaction_generation != m_map->m_compaction_generation) {
+                m_index = m_map->index_of_first_entry_not_below(m_next_insertion_id);
+                m_compaction_generation = m_map->m_compaction_generation;
+            }
+
+            while (m_index < entries.size() && entries[m_index].is_deleted())
+                ++m_index;
+
+            if (m_index < entries.size())
+                m_next_insertion_id = entries[m_index].insertion_id;
         }
 
         Conditional<IsConst, GC::Ref<Map const>, GC::Ref<Map>> m_map;
         mutable size_t m_index { 0 };
+        mutable size_t m_next_insertion_id { 0 };
+        mutable u32 m_compaction_generation { 0 };
     };
 
     using Iterator = IteratorImpl<false>;
@@ -109,13 +126,26 @@ public:
     Iterator begin() { return { *this }; }
     EndIterator end() const { return {}; }
 
+    void copy_entries_from(Map const&);
+
 private:
     explicit Map(Object& prototype);
     virtual void visit_edges(Visitor& visitor) override;
 
+    static constexpr u32 invalid_entry_index = NumericLimits<u32>::max();
+
+    Optional<size_t> find_entry_index(Value const& key, u32 hash) const;
+    size_t index_of_first_entry_not_below(size_t insertion_id) const;
+    void rehash(size_t bucket_count);
+
+    // NOTE: This is a deterministic hash table: entries live in a single vector in insertion order, and the buckets
+    //       only store the index of the most recently inserted entry that hashes to them, chaining through the entries.
+    //       Removed entries are left behind as tombstones until the next compaction.
+    Vector<Entry> m_entries;
+    Vector<u32> m_buckets;
+    size_t m_deleted_count { 0 };
     size_t m_next_insertion_id { 0 };
-    RedBlackTree<size_t, Value> m_keys;
-    HashMap<Value, Value, ValueTraits> m_entries;
+    u32 m_compaction_generation { 0 };
 };
 
 template<>
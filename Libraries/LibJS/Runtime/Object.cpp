@@ -1512,9 +1512,13 @@ void Object::visit_edges(Cell::Visitor& visitor)
     visitor.visit(m_shape);
     visitor.visit(m_storage);
 
-    m_indexed_properties.for_each_value([&visitor](auto& value) {
-        visitor.visit(value);
-    });
+    // OPTIMIZATION: Numbers are stored inline in their Value, so elements that are all numbers have no cells to visit.
+    auto const* indexed_storage = m_indexed_properties.storage();
+    if (!indexed_storage || !indexed_storage->is_simple_storage() || !static_cast<SimpleIndexedPropertyStorage const&>(*indexed_storage).holds_only_numbers()) {
+        m_indexed_properties.for_each_value([&visitor](auto& value) {
+            visitor.visit(value);
+        });
+    }
 
     if (m_private_elements) {
         for (auto& private_element : *m_private_elements)
@@ -16,6 +16,104 @@ GC_DEFINE_ALLOCATOR(PrototypeChainValidity);
 
 static HashTable<GC::Ptr<Shape>> s_all_prototype_shapes;
 
+PropertyTable::PropertyTable(PropertyTable const& other)
+    : m_entries(other.m_entries)
+{
+    if (other.m_hashed_index)
+        m_hashed_index = make<HashMap<PropertyKey, u32>>(*other.m_hashed_index);
+}
+
+PropertyTable& PropertyTable::operator=(PropertyTable const& other)
+{
+    if (this == &other)
+        return *this;
+    m_entries = other.m_entries;
+    if (other.m_hashed_index)
+        m_hashed_index = make<HashMap<PropertyKey, u32>>(*other.m_hashed_index);
+    else
+        m_hashed_index = nullptr;
+    return *this;
+}
+
+Optional<size_t> PropertyTable::index_of(PropertyKey const& key) const
+{
+    if (m_hashed_index) {
+        auto index = m_hashed_index->get(key);
+        if (!index.has_value())
+            return {};
+        return *index;
+    }
+    // OPTIMIZATION: Comparing a handful of keys is cheaper than hashing one, so small tables are searched linearly.
+    for (size_t i = 0; i < m_entries.size(); ++i) {
+        if (m_entries[i].key == key)
+            return i;
+    }
+    return {};
+}
+
+Optional<PropertyMetadata> PropertyTable::get(PropertyKey const& key) const
+{
+    auto index = index_of(key);
+    if (!index.has_value())
+        return {};
+    return m_entries[*index].value;
+}
+
+PropertyTable::Entry* PropertyTable::find(PropertyKey const& key)
+{
+    auto index = index_of(key);
+    if (!index.has_value())
+        return nullptr;
+    return &m_entries[*index];
+}
+
+AK::HashSetResult PropertyTable::set(PropertyKey const& key, PropertyMetadata value)
+{
+    if (auto* entry = find(key)) {
+        entry->value = value;
+        return AK::HashSetResult::ReplacedExistingEntry;
+    }
+    m_entries.append({ key, value });
+    if (m_hashed_index)
+        m_hashed_index->set(key, static_cast<u32>(m_entries.size() - 1));
+    else if (m_entries.size() > hashed_index_threshold)
+        build_hashed_index();
+    return AK::HashSetResult::InsertedNewEntry;
+}
+
+bool PropertyTable::remove(PropertyKey const& key)
+{
+    auto index = index_of(key);
+    if (!index.has_value())
+        return false;
+    m_entries.remove(*index);
+    if (m_hashed_index) {
+        m_hashed_index->remove(key);
+        for (auto& it : *m_hashed_index) {
+            if (it.value > *index)
+                --it.value;
+        }
+    }
+    return true;
+}
+
+Vector<PropertyKey> PropertyTable::keys() const
+{
+    Vector<PropertyKey> keys;
+    keys.ensure_capacity(m_entries.size());
+    for (auto const& entry : m_entries)
+        keys.unchecked_append(entry.key);
+    return keys;
+}
+
+void PropertyTable::build_hashed_index()
+{
+    m_hashed_index = make<HashMap<PropertyKey, u32>>();
+    m_hashed_index->ensure_capacity(m_entries.size());
+    for (u32 i = 0; i < m_entries.size(); ++i)
+        m_hashed_index->set(m_entries[i].key, i);
+}
+
 Shape::~Shape()
 {
     if (m_is_prototype_shape)
@@ -222,7 +320,7 @@ Optional<PropertyMetadata> Shape::lookup(PropertyKey const& property_key) const
     return property;
 }
 
-FLATTEN OrderedHashMap<PropertyKey, PropertyMetadata> const& Shape::property_table() const
+FLATTEN PropertyTable const& Shape::property_table() const
 {
     ensure_property_table();
     return *m_property_table;
@@ -232,7 +330,7 @@ void Shape::ensure_property_table() const
 {
     if (m_property_table)
         return;
-    m_property_table = make<OrderedHashMap<PropertyKey, PropertyMetadata>>();
+    m_property_table = make<PropertyTable>();
 
     u32 next_offset = 0;
 
@@ -255,14 +353,14 @@ void Shape::ensure_property_table() const
         if (shape.m_transition_type == TransitionType::Put) {
             m_property_table->set(*shape.m_property_key, { next_offset++, shape.m_attributes });
         } else if (shape.m_transition_type == TransitionType::Configure) {
-            auto it = m_property_table->find(*shape.m_property_key);
-            VERIFY(it != m_property_table->end());
-            it->value.attributes = shape.m_attributes;
+            auto* entry = m_property_table->find(*shape.m_property_key);
+            VERIFY(entry);
+            entry->value.attributes = shape.m_attributes;
         } else if (shape.m_transition_type == TransitionType::Delete) {
-            auto remove_it = m_property_table->find(*shape.m_property_key);
-            VERIFY(remove_it != m_property_table->end());
-            auto removed_offset = remove_it->value.offset;
-            m_property_table->remove(remove_it);
+            auto* removed_entry = m_property_table->find(*shape.m_property_key);
+            VERIFY(removed_entry);
+            auto removed_offset = removed_entry->value.offset;
+            m_property_table->remove(*shape.m_property_key);
             for (auto& it : *m_property_table) {
                 if (it.value.offset > removed_offset)
                     --it.value.offset;
@@ -299,10 +397,9 @@ void Shape::set_property_attributes_without_transition(PropertyKey const& proper
     invalidate_prototype_if_needed_for_change_without_transition();
     VERIFY(is_dictionary());
     VERIFY(m_property_table);
-    auto it = m_property_table->find(property_key);
-    VERIFY(it != m_property_table->end());
-    it->value.attributes = attributes;
-    m_property_table->set(property_key, it->value);
+    auto* entry = m_property_table->find(property_key);
+    VERIFY(entry);
+    entry->value.attributes = attributes;
 }
 
 void Shape::remove_property_without_transition(PropertyKey const& property_key, u32 offset)
@@ -10,6 +10,7 @@
 #include <AK/HashMap.h>
 #include <AK/OwnPtr.h>
 #include <AK/StringView.h>
+#include <AK/Vector.h>
 #include <AK/WeakPtr.h>
 #include <AK/Weakable.h>
 #include <LibJS/Export.h>
@@ -26,6 +27,44 @@ struct PropertyMetadata {
     PropertyAttributes attributes { 0 };
 };
 
+// Maps property keys to their metadata in insertion order. Most shapes only have a handful of properties, which are
+// cheaper to find by scanning a small array than by hashing, so the hashed index is only built for larger tables.
+class JS_API PropertyTable {
+public:
+    struct Entry {
+        PropertyKey key;
+        PropertyMetadata value;
+    };
+
+    static constexpr size_t hashed_index_threshold = 8;
+
+    PropertyTable() = default;
+    PropertyTable(PropertyTable const&);
+    PropertyTable& operator=(PropertyTable const&);
+
+    size_t size() const { return m_entries.size(); }
+    bool is_empty() const { return m_entries.is_empty(); }
+
+    Optional<PropertyMetadata> get(PropertyKey const&) const;
+    Entry* find(PropertyKey const&);
+    AK::HashSetResult set(PropertyKey const&, PropertyMetadata);
+    bool remove(PropertyKey const&);
+
+    Vector<PropertyKey> keys() const;
+
+    auto begin() const { return m_entries.begin(); }
+    auto end() const { return m_entries.end(); }
+    auto begin() { return m_entries.begin(); }
+    auto end() { return m_entries.end(); }
+
+private:
+    Optional<size_t> index_of(PropertyKey const&) const;
+    void build_hashed_index();
+
+    Vector<Entry> m_entries;
+    OwnPtr<HashMap<PropertyKey, u32>> m_hashed_index;
+};
+
 struct TransitionKey {
     PropertyKey property_key;
     PropertyAttributes attributes { 0 };
@@ -97,13 +136,10 @@ public:
     Object const* prototype() const { return m_prototype; }
 
     Optional<PropertyMetadata> lookup(PropertyKey const&) const;
-    OrderedHashMap<PropertyKey, PropertyMetadata> const& property_table() const;
+    PropertyTable const& property_table() const;
     u32 property_count() const { return m_property_count; }
 
-    struct Property {
-        PropertyKey key;
-        PropertyMetadata value;
-    };
+    using Property = PropertyTable::Entry;
 
     void set_prototype_without_transition(Object* new_prototype);
 
@@ -127,7 +163,7 @@ private:
 
     GC::Ref<Realm> m_realm;
 
-    mutable OwnPtr<OrderedHashMap<PropertyKey, PropertyMetadata>> m_property_table;
+    mutable OwnPtr<PropertyTable> m_property_table;
 
     OwnPtr<HashMap<TransitionKey, WeakPtr<Shape>>> m_forward_transitions;
     OwnPtr<HashMap<GC::Ptr<Object>, WeakPtr<Shape>>> m_prototype_transitions;
@@ -69,6 +69,20 @@ VM::VM(ErrorMessages error_messages)
     })
     , m_error_messages(move(error_messages))
 {
+    // NOTE: Execution contexts on the VM's stacks are visited precisely in gather_roots(), so the conservative
+    //       stack scan can skip the native stack memory they occupy, which is dominated by their register files.
+    m_heap.set_gather_precisely_scanned_ranges([this](Vector<ReadonlyBytes>& ranges) {
+        auto add_ranges_from_execution_context_stack = [&ranges](Vector<ExecutionContext*> const& stack) {
+            for (auto const* execution_context : stack) {
+                auto size = sizeof(ExecutionContext) + execution_context->registers_and_constants_and_locals_and_arguments_count * sizeof(Value);
+                ranges.append({ reinterpret_cast<u8 const*>(execution_context), size });
+            }
+        };
+        add_ranges_from_execution_context_stack(m_execution_context_stack);
+        for (auto& saved_stack : m_saved_execution_context_stacks)
+            add_ranges_from_execution_context_stack(saved_stack);
+    });
+
     m_bytecode_interpreter = make<Bytecode::Interpreter>(*this);
 
     m_empty_string = m_heap.allocate<PrimitiveString>(String {});
@@ -546,6 +560,47 @@ VM::StoredModule* VM::get_stored_module(ImportedModuleReferrer const&, ByteStrin
     return &(*end_or_module);
 }
 
+RefPtr<Program> VM::find_cached_script_parse_node(Utf16String const& source_text, StringView filename, size_t line_number_offset) const
+{
+    if (source_text.length_in_code_units() < minimum_cached_script_source_length)
+        return nullptr;
+
+    auto source_hash = source_text.hash();
+    for (auto const& entry : m_script_parse_node_cache) {
+        if (entry.source_hash != source_hash || entry.source_length != source_text.length_in_code_units())
+            continue;
+        if (entry.line_number_offset != line_number_offset || entry.filename != filename)
+            continue;
+        // NOTE: The hash only narrows down the candidates, the source text itself must be identical.
+        if (entry.parse_node->source_code().code() != source_text)
+            continue;
+        return entry.parse_node;
+    }
+    return nullptr;
+}
+
+void VM::cache_script_parse_node(Utf16String const& source_text, StringView filename, size_t line_number_offset, NonnullRefPtr<Program> parse_node)
+{
+    auto source_length = source_text.length_in_code_units();
+    if (source_length < minimum_cached_script_source_length || source_length > maximum_cached_script_source_length)
+        return;
+
+    while (!m_script_parse_node_cache.is_empty()
+        && (m_script_parse_node_cache.size() >= script_parse_node_cache_size
+            || m_script_parse_node_cache_source_length + source_length > maximum_cached_script_source_length)) {
+        m_script_parse_node_cache_source_length -= m_script_parse_node_cache.take_first().source_length;
+    }
+
+    m_script_parse_node_cache_source_length += source_length;
+    m_script_parse_node_cache.append({
+        .source_hash = source_text.hash(),
+        .source_length = source_length,
+        .line_number_offset = line_number_offset,
+        .filename = filename,
+        .parse_node = move(parse_node),
+    });
+}
+
 ThrowCompletionOr<void> VM::link_and_eval_module(Badge<Bytecode::Interpreter>, SourceTextModule& module)
 {
     return link_and_eval_module(module);
@@ -274,6 +274,15 @@ public:
     void clear_execution_context_stack();
     void restore_execution_context_stack();
 
+    // Scripts with identical source text (e.g. the same library bundle loaded by several documents) reuse the
+    // already parsed AST, and with it the bytecode that has been generated for its functions so far.
+    static constexpr size_t script_parse_node_cache_size = 16;
+    static constexpr size_t minimum_cached_script_source_length = 4 * KiB;
+    // NOTE: Bounds the total source length of the cached scripts, since each entry keeps its whole AST alive.
+    static constexpr size_t maximum_cached_script_source_length = 4 * MiB;
+    RefPtr<Program> find_cached_script_parse_node(Utf16String const& source_text, StringView filename, size_t line_number_offset) const;
+    void cache_script_parse_node(Utf16String const& source_text, StringView filename, size_t line_number_offset, NonnullRefPtr<Program>);
+
     // Do not call this method unless you are sure this is the only and first module to be loaded in this vm.
     ThrowCompletionOr<void> link_and_eval_module(Badge<Bytecode::Interpreter>, SourceTextModule& module);
 
@@ -360,6 +369,16 @@ private:
 
     Vector<StoredModule> m_loaded_modules;
 
+    struct CachedScriptParseNode {
+        u32 source_hash { 0 };
+        size_t source_length { 0 };
+        size_t line_number_offset { 0 };
+        ByteString filename;
+        NonnullRefPtr<Program> parse_node;
+    };
+    Vector<CachedScriptParseNode> m_script_parse_node_cache;
+    size_t m_script_parse_node_cache_source_length { 0 };
+
     WellKnownSymbols m_well_known_symbols;
 
     u32 m_execution_generation { 0 };
@@ -14,17 +14,37 @@ namespace JS {
 
 GC_DEFINE_ALLOCATOR(Script);
 
-// 16.1.5 ParseScript ( sourceText, realm, hostDefined ), https://tc39.es/ecma262/#sec-parse-script
 Result<GC::Ref<Script>, Vector<ParserError>> Script::parse(StringView source_text, Realm& realm, StringView filename, HostDefined* host_defined, size_t line_number_offset)
 {
+    return parse(Lexer(source_text, filename, line_number_offset), realm, filename, host_defined, line_number_offset);
+}
+
+Result<GC::Ref<Script>, Vector<ParserError>> Script::parse(Utf16String source_text, Realm& realm, StringView filename, HostDefined* host_defined, size_t line_number_offset)
+{
+    return parse(Lexer(move(source_text), filename, line_number_offset), realm, filename, host_defined, line_number_offset);
+}
+
+// 16.1.5 ParseScript ( sourceText, realm, hostDefined ), https://tc39.es/ecma262/#sec-parse-script
+Result<GC::Ref<Script>, Vector<ParserError>> Script::parse(Lexer lexer, Realm& realm, StringView filename, HostDefined* host_defined, size_t line_number_offset)
+{
+    auto& vm = realm.vm();
+
+    // OPTIMIZATION: Parsing is deterministic, so if we've already parsed this exact source text, reuse its AST.
+    if (auto cached_script = vm.find_cached_script_parse_node(lexer.source(), filename, line_number_offset))
+        return realm.heap().allocate<Script>(realm, filename, cached_script.release_nonnull(), host_defined);
+
+    auto source_text = lexer.source();
+
     // 1. Let script be ParseText(sourceText, Script).
-    auto parser = Parser(Lexer(source_text, filename, line_number_offset));
+    auto parser = Parser(move(lexer));
     auto script = parser.parse_program();
 
     // 2. If script is a List of errors, return body.
     if (parser.has_errors())
         return parser.errors();
 
+    vm.cache_script_parse_node(source_text, filename, line_number_offset, script);
+
     // 3. Return Script Record { [[Realm]]: realm, [[ECMAScriptCode]]: script, [[HostDefined]]: hostDefined }.
     return realm.heap().allocate<Script>(realm, filename, move(script), host_defined);
 }
@@ -10,6 +10,7 @@
 #include <LibGC/Ptr.h>
 #include <LibGC/Root.h>
 #include <LibJS/Export.h>
+#include <LibJS/Lexer.h>
 #include <LibJS/ParserError.h>
 #include <LibJS/Runtime/Realm.h>
 
@@ -37,6 +38,7 @@ public:
 
     virtual ~Script() override;
     static Result<GC::Ref<Script>, Vector<ParserError>> parse(StringView source_text, Realm&, StringView filename = {}, HostDefined* = nullptr, size_t line_number_offset = 1);
+    static Result<GC::Ref<Script>, Vector<ParserError>> parse(Utf16String source_text, Realm&, StringView filename = {}, HostDefined* = nullptr, size_t line_number_offset = 1);
 
     Realm& realm() { return *m_realm; }
     Program const& parse_node() const { return *m_parse_node; }
@@ -49,6 +51,8 @@ public:
 private:
     Script(Realm&, StringView filename, NonnullRefPtr<Program>, HostDefined* = nullptr);
 
+    static Result<GC::Ref<Script>, Vector<ParserError>> parse(Lexer, Realm&, StringView filename, HostDefined*, size_t line_number_offset);
+
     virtual void visit_edges(Cell::Visitor&) override;
 
     GC::Ptr<Realm> m_realm;                       // [[Realm]]
@@ -7,6 +7,7 @@
 
 #pragma once
 
+#include <AK/ByteString.h>
 #include <AK/NonnullRefPtr.h>
 #include <AK/StringView.h>
 #include <AK/Types.h>
@@ -33,6 +34,13 @@ struct UnrealizedSourceRange {
         return source_code->range_from_offsets(start_offset, end_offset);
     }
 
+    [[nodiscard]] ByteString source_text() const
+    {
+        if (!source_code)
+            return {};
+        return MUST(source_code->code().substring_view(start_offset, end_offset - start_offset).to_byte_string());
+    }
+
     RefPtr<SourceCode const> source_code;
     u32 start_offset { 0 };
     u32 end_offset { 0 };
@@ -123,6 +123,17 @@ describe("correct behavior", () => {
         expect(class { static async *foo() {} }.foo.toString()).toBe("async *foo() {}");
     });
 
+    // prettier-ignore
+    test("nested function", () => {
+        function outer() {
+            return [function inner(a) { return "ü" + a; }, class Inner { "☃"() {} }];
+        }
+        const [inner, Inner] = outer();
+        expect(inner.toString()).toBe('function inner(a) { return "ü" + a; }');
+        expect(Inner.toString()).toBe('class Inner { "☃"() {} }');
+        expect(outer.toString().includes('class Inner { "☃"() {} }')).toBeTrue();
+    });
+
     test("native function", () => {
         // Built-in functions
         expect(console.debug.toString()).toBe("function debug() { [native code] }");
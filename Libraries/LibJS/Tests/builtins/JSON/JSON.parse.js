@@ -74,3 +74,42 @@ test("does not truncate large integers", () => {
     expect(JSON.parse("18446744073709551616")).toEqual(18446744073709551616);
     expect(JSON.parse("18446744073709551617")).toEqual(18446744073709551617);
 });
+
+test("string escapes", () => {
+    expect(JSON.parse('"\\"\\\\\\/\\b\\f\\n\\r\\t"')).toBe('"\\/\b\f\n\r\t');
+    expect(JSON.parse('"caf\\u00e9 \\uD834\\uDD1E"')).toBe("café 𝄞");
+    expect(JSON.parse('"\\uD800"')).toBe("\uD800");
+    expect(JSON.parse('"\\uDC00\\uD800"')).toBe("\uDC00\uD800");
+    expect(JSON.parse('{"\\u0061":1}')).toEqual({ a: 1 });
+
+    ['"\\x41"', '"\\u12"', '"\\u12G4"', '"\\', '"abc', '"a\nb"'].forEach(testCase => {
+        expect(() => JSON.parse(testCase)).toThrow(SyntaxError);
+    });
+});
+
+test("objects with repeated and numeric keys", () => {
+    const array = JSON.parse('[{"a":1,"b":2},{"a":3,"b":4},{"b":5,"a":6}]');
+    expect(Object.keys(array[0])).toEqual(["a", "b"]);
+    expect(Object.keys(array[1])).toEqual(["a", "b"]);
+    expect(Object.keys(array[2])).toEqual(["b", "a"]);
+    expect(array[1].a).toBe(3);
+    expect(array[2].a).toBe(6);
+
+    const object = JSON.parse('{"b":1,"0":2,"a":3,"b":4}');
+    expect(Object.keys(object)).toEqual(["0", "b", "a"]);
+    expect(object.b).toBe(4);
+
+    expect(Object.getPrototypeOf(JSON.parse('{"__proto__":1}'))).toBe(Object.prototype);
+    expect(JSON.parse('{"__proto__":1}').__proto__).toBe(1);
+});
+
+test("number syntax", () => {
+    expect(JSON.parse("-12.5e2")).toBe(-1250);
+    expect(JSON.parse("1E+2")).toBe(100);
+    expect(JSON.parse("1e-2")).toBe(0.01);
+    expect(JSON.parse("-123456789012345")).toBe(-123456789012345);
+
+    ["01", "-", "1.", ".5", "1e", "1e+", "+1", "0x10"].forEach(testCase => {
+        expect(() => JSON.parse(testCase)).toThrow(SyntaxError);
+    });
+});
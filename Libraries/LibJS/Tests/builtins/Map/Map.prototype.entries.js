@@ -17,3 +17,46 @@ test("basic functionality", () => {
     expect(it.next()).toEqual({ value: undefined, done: true });
     expect(it.next()).toEqual({ value: undefined, done: true });
 });
+
+test("iterator stays valid while the map is mutated", () => {
+    const map = new Map();
+    for (let i = 0; i < 100; ++i) map.set(i, i * 2);
+
+    const it = map.entries();
+    expect(it.next().value).toEqual([0, 0]);
+    expect(it.next().value).toEqual([1, 2]);
+
+    // Remove enough entries to make the map compact its storage.
+    for (let i = 0; i < 90; ++i) map.delete(i);
+    map.set("new", 42);
+    map.set(95, "updated");
+
+    const rest = [];
+    for (let result = it.next(); !result.done; result = it.next()) rest.push(result.value);
+    expect(rest).toEqual([
+        [90, 180],
+        [91, 182],
+        [92, 184],
+        [93, 186],
+        [94, 188],
+        [95, "updated"],
+        [96, 192],
+        [97, 194],
+        [98, 196],
+        [99, 198],
+        ["new", 42],
+    ]);
+});
+
+test("iterator continues with entries added after clear", () => {
+    const map = new Map([
+        ["a", 1],
+        ["b", 2],
+    ]);
+    const it = map.keys();
+    expect(it.next().value).toBe("a");
+    map.clear();
+    map.set("c", 3);
+    expect(it.next()).toEqual({ value: "c", done: false });
+    expect(it.next()).toEqual({ value: undefined, done: true });
+});
@@ -0,0 +1,100 @@
+test("constant comparisons in conditions", () => {
+    let taken = [];
+    if (1 < 2) taken.push("lt");
+    if (2 <= 1) taken.push("le");
+    if (NaN == NaN) taken.push("nan");
+    if ("a" === "a") taken.push("strict");
+    if (null ?? true) taken.push("nullish");
+    expect(taken).toEqual(["lt", "strict", "nullish"]);
+});
+
+test("branches with identical targets still evaluate their condition", () => {
+    let calls = 0;
+    const condition = () => {
+        calls++;
+        return calls > 1;
+    };
+    if (condition()) {
+    }
+    if (condition()) {
+    }
+    expect(calls).toBe(2);
+});
+
+test("swapping values through temporaries", () => {
+    let a = 1;
+    let b = 2;
+    for (let i = 0; i < 3; ++i) {
+        let t = a;
+        a = b;
+        b = t;
+    }
+    expect(a).toBe(2);
+    expect(b).toBe(1);
+});
+
+test("values live across loop back edges", () => {
+    let sum = 0;
+    for (let i = 0; i < 4; ++i) {
+        const before = sum + i;
+        for (let j = 0; j < 3; ++j) {
+            const inner = before * j;
+            sum += inner - j;
+        }
+    }
+    expect(sum).toBe(-174);
+});
+
+test("values live across finally blocks and scheduled jumps", () => {
+    const log = [];
+    for (let i = 0; i < 3; ++i) {
+        const value = i * 10;
+        try {
+            if (i === 1) continue;
+            if (i === 2) break;
+            log.push(value);
+        } finally {
+            log.push(`finally ${value}`);
+        }
+    }
+    expect(log).toEqual([0, "finally 0", "finally 10", "finally 20"]);
+});
+
+test("values live across catch handlers in loops", () => {
+    let caught = 0;
+    const offset = 5;
+    for (let i = 0; i < 3; ++i) {
+        const before = i + offset;
+        try {
+            if (i % 2 === 0) throw before;
+        } catch (e) {
+            caught += e - before + i;
+        }
+    }
+    expect(caught).toBe(2);
+});
+
+test("values live across yields", () => {
+    function* generator() {
+        let total = 0;
+        for (let i = 0; i < 3; ++i) {
+            const doubled = i * 2;
+            const received = yield doubled;
+            total += doubled + received;
+        }
+        return total;
+    }
+    const iterator = generator();
+    expect(iterator.next().value).toBe(0);
+    expect(iterator.next(1).value).toBe(2);
+    expect(iterator.next(1).value).toBe(4);
+    expect(iterator.next(1)).toEqual({ value: 9, done: true });
+});
+
+test("infinite loops made of empty blocks can still be left", () => {
+    let i = 0;
+    for (;;) {
+        if (++i === 3) break;
+    }
+    expect(i).toBe(3);
+});
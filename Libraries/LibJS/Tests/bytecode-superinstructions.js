@@ -0,0 +1,76 @@
+test("method calls without arguments", () => {
+    const object = {
+        value: 42,
+        method() {
+            return this.value;
+        },
+    };
+    expect(object.method()).toBe(42);
+    expect([1, 2, 3].pop()).toBe(3);
+    expect(Math.random() < 1).toBeTrue();
+});
+
+test("method calls with constant arguments", () => {
+    const object = {
+        add(a, b) {
+            return this.base + a + b;
+        },
+        base: 10,
+    };
+    expect(object.add(1, 2)).toBe(13);
+    expect("abc".charAt(1)).toBe("b");
+});
+
+test("method lookup goes through getters exactly once", () => {
+    let lookups = 0;
+    const object = {
+        get method() {
+            lookups++;
+            return function () {
+                return this;
+            };
+        },
+    };
+    expect(object.method()).toBe(object);
+    expect(lookups).toBe(1);
+});
+
+test("method calls on a variable that is reassigned by the call", () => {
+    let object = {
+        next() {
+            return this.successor;
+        },
+        successor: {
+            next() {
+                return null;
+            },
+        },
+    };
+    object = object.next();
+    expect(object.next()).toBeNull();
+});
+
+test("errors from fused method calls", () => {
+    const object = {};
+    expect(() => object.missing()).toThrowWithMessage(
+        TypeError,
+        "undefined is not a function (evaluated from 'object.missing')"
+    );
+    expect(() => undefined.method()).toThrow(TypeError);
+});
+
+test("negated conditions", () => {
+    const taken = [];
+    const values = [0, 1, "", "a", null, undefined, NaN, {}, []];
+    for (const value of values) {
+        if (!value) taken.push(value);
+    }
+    expect(taken).toEqual([0, "", null, undefined, NaN]);
+
+    let i = 0;
+    while (!(i >= 3)) i++;
+    expect(i).toBe(3);
+
+    const negated = !taken.length;
+    expect(negated).toBeFalse();
+});
@@ -0,0 +1,75 @@
+test("same call site calling different functions", () => {
+    const functions = [
+        (a, b) => a + b,
+        (a, b) => a * b,
+        function (a) {
+            return [this, a];
+        },
+        Math.max,
+    ];
+    const results = [];
+    for (let i = 0; i < 8; ++i) results.push(functions[i % functions.length](3, 4));
+    expect(results[0]).toBe(7);
+    expect(results[1]).toBe(12);
+    expect(results[2][1]).toBe(3);
+    expect(results[3]).toBe(4);
+    expect(results.slice(4, 6)).toEqual(results.slice(0, 2));
+});
+
+test("cached calls with missing and extra arguments", () => {
+    function collect(a, b, c) {
+        return [a, b, c, arguments.length];
+    }
+    for (let i = 0; i < 3; ++i) {
+        expect(collect(1)).toEqual([1, undefined, undefined, 1]);
+        expect(collect(1, 2, 3, 4)).toEqual([1, 2, 3, 4]);
+    }
+});
+
+test("cached calls keep the receiver", () => {
+    const prototype = {
+        get() {
+            return this.value;
+        },
+    };
+    const objects = [1, 2, 3].map(value => ({ __proto__: prototype, value }));
+    expect(objects.map(object => object.get())).toEqual([1, 2, 3]);
+});
+
+test("class constructors still throw at a call site that cached a function", () => {
+    class C {}
+    const callees = [() => 1, C];
+    const call = callee => callee();
+    expect(call(callees[0])).toBe(1);
+    expect(() => call(callees[1])).toThrowWithMessage(
+        TypeError,
+        "Class constructor C must be called with 'new'"
+    );
+    expect(call(callees[0])).toBe(1);
+});
+
+test("recursion through a cached call site", () => {
+    function fibonacci(n) {
+        return n < 2 ? n : fibonacci(n - 1) + fibonacci(n - 2);
+    }
+    expect(fibonacci(15)).toBe(610);
+});
+
+test("cached callee that has been garbage collected", () => {
+    const call = callee => callee();
+    for (let i = 0; i < 3; ++i) {
+        expect(call(() => i)).toBe(i);
+        gc();
+    }
+});
+
+test("megamorphic call site keeps calling the right functions", () => {
+    const call = (callee, value) => callee(value);
+    const functions = [];
+    for (let i = 0; i < 10; ++i) functions.push(value => value + i);
+    for (let round = 0; round < 3; ++round) {
+        for (let i = 0; i < functions.length; ++i)
+            expect(call(functions[i], round)).toBe(round + i);
+    }
+    for (let i = 0; i < 3; ++i) expect(call(functions[0], i)).toBe(i);
+});
@@ -0,0 +1,90 @@
+test("reading and writing numeric elements", () => {
+    const array = [1, 2, 3];
+    array[1] = 2.5;
+    array[2] = -0;
+    expect(array[0]).toBe(1);
+    expect(array[1]).toBe(2.5);
+    expect(array[2]).toBe(-0);
+    expect(array[3]).toBeUndefined();
+
+    array[0] = "one";
+    expect(array).toEqual(["one", 2.5, -0]);
+});
+
+test("objects stored into numeric arrays stay alive", () => {
+    const array = [1, 2, 3];
+    array[1] = { value: 42 };
+    gc();
+    expect(array[1].value).toBe(42);
+
+    array.length = 0;
+    array.push({ value: 1 });
+    gc();
+    expect(array[0].value).toBe(1);
+});
+
+test("holes in numeric arrays", () => {
+    const array = [1, 2, 3];
+    array[5] = 6;
+    expect(array[4]).toBeUndefined();
+    expect(array.indexOf(undefined)).toBe(-1);
+    expect(array.includes(undefined)).toBeTrue();
+    expect(array.indexOf(6)).toBe(5);
+
+    Array.prototype[4] = 5;
+    try {
+        expect(array[4]).toBe(5);
+        expect(array.indexOf(5)).toBe(4);
+    } finally {
+        delete Array.prototype[4];
+    }
+});
+
+test("searching numeric arrays", () => {
+    const array = [1, 2.5, NaN, -0, 2.5];
+    expect(array.includes(NaN)).toBeTrue();
+    expect(array.indexOf(NaN)).toBe(-1);
+    expect(array.indexOf(0)).toBe(3);
+    expect(array.includes(+0)).toBeTrue();
+    expect(array.indexOf(2.5)).toBe(1);
+    expect(array.indexOf(2.5, 2)).toBe(4);
+    expect(array.lastIndexOf(2.5)).toBe(4);
+    expect(array.lastIndexOf(2.5, -2)).toBe(1);
+    expect(array.indexOf("1")).toBe(-1);
+    expect(array.includes("1")).toBeFalse();
+    expect(array.lastIndexOf(1, -10)).toBe(-1);
+});
+
+test("searching int32 arrays", () => {
+    const array = [0, 1, -2147483648, 2147483647, 1];
+    expect(array.indexOf(1)).toBe(1);
+    expect(array.lastIndexOf(1)).toBe(4);
+    expect(array.indexOf(-0)).toBe(0);
+    expect(array.lastIndexOf(-0)).toBe(0);
+    expect(array.includes(-0)).toBeTrue();
+    expect(array.indexOf(-2147483648)).toBe(2);
+    expect(array.indexOf(2147483647)).toBe(3);
+    expect(array.indexOf(2147483648)).toBe(-1);
+    expect(array.includes(-2147483649)).toBeFalse();
+    expect(array.indexOf(1.5)).toBe(-1);
+    expect(array.includes(NaN)).toBeFalse();
+    expect(array.includes(Infinity)).toBeFalse();
+    expect(array.lastIndexOf(1, 3)).toBe(1);
+    expect(array.includes(0, 1)).toBeFalse();
+
+    array.push(0.5);
+    expect(array.indexOf(0.5)).toBe(5);
+    expect(array.indexOf(-0)).toBe(0);
+});
+
+test("searching a numeric array that changes while converting fromIndex", () => {
+    const array = [1, 2, 3, 4];
+    const fromIndex = {
+        valueOf() {
+            array.length = 2;
+            return 0;
+        },
+    };
+    expect(array.indexOf(4, fromIndex)).toBe(-1);
+    expect(array.includes(undefined, fromIndex)).toBeFalse();
+});
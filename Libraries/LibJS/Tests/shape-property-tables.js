@@ -0,0 +1,57 @@
+const makeObject = count => {
+    const object = {};
+    for (let i = 0; i < count; ++i) object[`p${i}`] = i;
+    return object;
+};
+
+test("property lookups on small and large shapes", () => {
+    for (const count of [1, 8, 9, 40]) {
+        const object = makeObject(count);
+        for (let i = 0; i < count; ++i) expect(object[`p${i}`]).toBe(i);
+        expect(object[`p${count}`]).toBeUndefined();
+        expect(Object.keys(object)).toHaveLength(count);
+    }
+});
+
+test("deleting properties keeps the remaining ones in order", () => {
+    for (const count of [4, 12]) {
+        const object = makeObject(count);
+        delete object.p1;
+        delete object[`p${count - 1}`];
+        object.p1 = "again";
+        const keys = Object.keys(object);
+        expect(keys[0]).toBe("p0");
+        expect(keys[1]).toBe("p2");
+        expect(keys[keys.length - 1]).toBe("p1");
+        expect(keys).toHaveLength(count - 1);
+        expect(object.p2).toBe(2);
+        expect(object.p1).toBe("again");
+        expect(object[`p${count - 1}`]).toBeUndefined();
+    }
+});
+
+test("reconfiguring properties", () => {
+    for (const count of [3, 20]) {
+        const object = makeObject(count);
+        Object.defineProperty(object, "p2", { enumerable: false });
+        expect(Object.keys(object)).not.toContain("p2");
+        expect(object.p2).toBe(2);
+        Object.defineProperty(object, "p0", { writable: false });
+        object.p0 = "changed";
+        expect(object.p0).toBe(0);
+    }
+});
+
+test("symbol and string keys share a table", () => {
+    const symbols = [];
+    const object = {};
+    for (let i = 0; i < 12; ++i) {
+        const symbol = Symbol(`s${i}`);
+        symbols.push(symbol);
+        object[symbol] = i;
+        object[`s${i}`] = -i;
+    }
+    symbols.forEach((symbol, i) => expect(object[symbol]).toBe(i));
+    expect(Object.getOwnPropertySymbols(object)).toEqual(symbols);
+    expect(object.s11).toBe(-11);
+});
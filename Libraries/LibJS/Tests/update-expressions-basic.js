@@ -42,6 +42,23 @@ describe("correct behavior", () => {
         expect(s--).toBeNaN();
         expect(s).toBeNaN();
     });
+
+    test("updates that overflow the Int32 range", () => {
+        let n = 2147483647;
+        expect(++n).toBe(2147483648);
+        expect(n++).toBe(2147483648);
+        expect(n).toBe(2147483649);
+
+        n = -2147483648;
+        expect(--n).toBe(-2147483649);
+        expect(n--).toBe(-2147483649);
+        expect(n).toBe(-2147483650);
+
+        n = -2147483648;
+        expect(n - 1).toBe(-2147483649);
+        expect(n + -1).toBe(-2147483649);
+        expect(2147483647 + 1).toBe(2147483648);
+    });
 });
 
 describe("errors", () => {
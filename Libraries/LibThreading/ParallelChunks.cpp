@@ -0,0 +1,161 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/NonnullRefPtr.h>
+#include <AK/Optional.h>
+#include <AK/Vector.h>
+#include <LibCore/System.h>
+#include <LibThreading/ConditionVariable.h>
+#include <LibThreading/Mutex.h>
+#include <LibThreading/ParallelChunks.h>
+#include <LibThreading/Thread.h>
+
+namespace Threading {
+
+static constexpr size_t max_parallel_chunk_count = 8;
+
+namespace {
+
+struct Batch {
+    Function<void(size_t, size_t, size_t)> const& callback;
+    size_t item_count { 0 };
+    size_t chunk_count { 0 };
+    size_t items_per_chunk { 0 };
+    size_t next_chunk { 0 };
+    size_t unfinished_chunks { 0 };
+
+    void run_chunk(size_t chunk_index) const
+    {
+        auto start = min(chunk_index * items_per_chunk, item_count);
+        auto end = min(start + items_per_chunk, item_count);
+        callback(chunk_index, start, end);
+    }
+};
+
+class WorkerPool {
+public:
+    static WorkerPool& the()
+    {
+        // NOTE: The workers run for as long as the process does, so the pool is never destroyed.
+        static auto* pool = new WorkerPool;
+        return *pool;
+    }
+
+    void run(Batch& batch)
+    {
+        {
+            MutexLocker locker(m_mutex);
+            start_workers(batch.chunk_count - 1);
+            m_batches.append(&batch);
+            m_work_available.broadcast();
+        }
+
+        // NOTE: The calling thread works on its own batch as well, so it completes even if every worker is busy
+        //       with someone else's batch, or no worker could be started at all.
+        for (auto chunk_index = take_chunk_from(batch); chunk_index.has_value(); chunk_index = take_chunk_from(batch)) {
+            batch.run_chunk(*chunk_index);
+            finish_chunk_of(batch);
+        }
+
+        MutexLocker locker(m_mutex);
+        while (batch.unfinished_chunks > 0)
+            m_batch_finished.wait();
+    }
+
+private:
+    WorkerPool() = default;
+
+    void start_workers(size_t count)
+    {
+        while (m_workers.size() < count) {
+            auto thread = Thread::try_create([this] {
+                work();
+                return static_cast<intptr_t>(0);
+            },
+                "Worker pool"sv);
+            if (thread.is_error())
+                return;
+            thread.value()->start();
+            thread.value()->detach();
+            m_workers.append(thread.release_value());
+        }
+    }
+
+    Optional<size_t> take_chunk_from(Batch& batch)
+    {
+        MutexLocker locker(m_mutex);
+        return take_chunk_from_locked(batch);
+    }
+
+    Optional<size_t> take_chunk_from_locked(Batch& batch)
+    {
+        if (batch.next_chunk == batch.chunk_count)
+            return {};
+        auto chunk_index = batch.next_chunk++;
+        if (batch.next_chunk == batch.chunk_count)
+            m_batches.remove_first_matching([&](auto* other) { return other == &batch; });
+        return chunk_index;
+    }
+
+    void finish_chunk_of(Batch& batch)
+    {
+        MutexLocker locker(m_mutex);
+        if (--batch.unfinished_chunks == 0)
+            m_batch_finished.broadcast();
+    }
+
+    void work()
+    {
+        for (;;) {
+            Batch* batch = nullptr;
+            Optional<size_t> chunk_index;
+            {
+                MutexLocker locker(m_mutex);
+                while (m_batches.is_empty())
+                    m_work_available.wait();
+                batch = m_batches.first();
+                chunk_index = take_chunk_from_locked(*batch);
+            }
+            batch->run_chunk(*chunk_index);
+            finish_chunk_of(*batch);
+        }
+    }
+
+    Mutex m_mutex;
+    ConditionVariable m_work_available { m_mutex };
+    ConditionVariable m_batch_finished { m_mutex };
+    Vector<Batch*> m_batches;
+    Vector<NonnullRefPtr<Thread>> m_workers;
+};
+
+}
+
+size_t parallel_chunk_count(size_t item_count, size_t min_items_per_chunk)
+{
+    static size_t const hardware_concurrency = max(Core::System::hardware_concurrency(), 1u);
+    return min(min(hardware_concurrency, max_parallel_chunk_count), max(item_count / min_items_per_chunk, 1uz));
+}
+
+void for_each_chunk_in_parallel(size_t item_count, size_t chunk_count, Function<void(size_t chunk_index, size_t start, size_t end)> const& callback)
+{
+    VERIFY(chunk_count > 0);
+    if (chunk_count == 1) {
+        callback(0, 0, item_count);
+        return;
+    }
+
+    Batch batch {
+        .callback = callback,
+        .item_count = item_count,
+        .chunk_count = chunk_count,
+        .items_per_chunk = ceil_div(item_count, chunk_count),
+        .next_chunk = 0,
+        .unfinished_chunks = chunk_count,
+    };
+    WorkerPool::the().run(batch);
+}
+
+}
@@ -0,0 +1,23 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/Function.h>
+#include <AK/Types.h>
+
+namespace Threading {
+
+// The number of contiguous chunks that item_count items should be split into, so that each chunk has at least
+// min_items_per_chunk items and there aren't more chunks than cores to process them on.
+size_t parallel_chunk_count(size_t item_count, size_t min_items_per_chunk);
+
+// Splits item_count items into chunk_count contiguous chunks, and calls callback(chunk_index, start, end) once for each
+// of them. The chunks are processed by the calling thread and a pool of worker threads that is shared by the whole
+// process and started on first use. Returns once all chunks have been processed.
+void for_each_chunk_in_parallel(size_t item_count, size_t chunk_count, Function<void(size_t chunk_index, size_t start, size_t end)> const& callback);
+
+}
@@ -461,6 +461,7 @@ public:
                 return false;
         }
         auto previous_size = m_size;
+        reserve_for_growth(new_size);
         if (m_data.try_resize(new_size).is_error())
             return false;
         m_size = new_size;
@@ -491,6 +492,38 @@ private:
     {
     }
 
+    // OPTIMIZATION: Resizing the buffer past its capacity copies the entire memory, which stalls programs that grow
+    //               their memory frequently. We reserve address space ahead of time instead, so that most grows
+    //               happen in place. Large allocations are backed by anonymous mappings whose pages are only
+    //               committed once they are touched, so the reservation is cheap until the memory is actually used.
+    void reserve_for_growth(u64 new_size)
+    {
+        if constexpr (sizeof(FlatPtr) == 8) {
+            if (new_size <= m_data.capacity())
+                return;
+
+            u64 max_size = max_reservation_size;
+            if (auto max = m_type.limits().max(); max.has_value())
+                max_size = min(max_size, static_cast<u64>(max.value()) * Constants::page_size);
+
+#if !defined(AK_OS_WINDOWS)
+            // If the memory has a maximum size, reserve all of it up front, so it never has to move again.
+            // NOTE: Windows commits heap allocations eagerly, so we only do this where reservations are free.
+            if (m_type.limits().max().has_value() && new_size >= reservation_threshold && max_size > new_size) {
+                if (!m_data.try_ensure_capacity(max_size).is_error())
+                    return;
+            }
+#endif
+
+            // Otherwise, at least double the capacity, so that the cost of copying is amortized over many grows.
+            (void)m_data.try_ensure_capacity(max(new_size, min(static_cast<u64>(m_data.capacity()) * 2, max_size)));
+        }
+    }
+
+    // Memories smaller than this are cheap enough to copy that reserving their maximum size is not worth it.
+    static constexpr u64 reservation_threshold = 16 * Constants::page_size;
+    static constexpr u64 max_reservation_size = Constants::page_size * 65536ull;
+
     MemoryType m_type;
     size_t m_size { 0 };
     ByteBuffer m_data;
@@ -19,6 +19,7 @@
 #include <LibWasm/AbstractMachine/BytecodeInterpreter.h>
 #include <LibWasm/AbstractMachine/Configuration.h>
 #include <LibWasm/AbstractMachine/Operators.h>
+#include <LibWasm/AbstractMachine/Profiler.h>
 #include <LibWasm/Opcode.h>
 #include <LibWasm/Printer/Printer.h>
 #include <LibWasm/Types.h>
@@ -85,6 +86,17 @@ void BytecodeInterpreter::interpret(Configuration& configuration)
     m_trap = Empty {};
     auto& expression = configuration.frame().expression();
     auto const should_limit_instruction_count = configuration.should_limit_instruction_count();
+    if (m_profiler && m_profiler->counts_opcodes()) [[unlikely]] {
+        // NOTE: Directly threaded handlers never return to the dispatch loop, so count opcodes in the (slower) loop instead.
+        if (!expression.compiled_instructions.dispatches.is_empty()) {
+            if (should_limit_instruction_count)
+                return interpret_impl<true, true, false, true>(configuration, expression);
+            return interpret_impl<true, false, false, true>(configuration, expression);
+        }
+        if (should_limit_instruction_count)
+            return interpret_impl<false, true, false, true>(configuration, expression);
+        return interpret_impl<false, false, false, true>(configuration, expression);
+    }
     if (!expression.compiled_instructions.dispatches.is_empty()) {
         if (expression.compiled_instructions.direct) {
             if (should_limit_instruction_count)
@@ -1033,6 +1045,24 @@ HANDLE_INSTRUCTION(synthetic_i32_add2local)
     TAILCALL return continue_(HANDLER_PARAMS(DECOMPOSE_PARAMS_NAME_ONLY));
 }
 
+HANDLE_INSTRUCTION(synthetic_i32_sub2local)
+{
+    configuration.push_to_destination(Value(static_cast<i32>(Operators::Subtract {}(configuration.local(instruction->local_index()).to<u32>(), configuration.local(instruction->arguments().get<LocalIndex>()).to<u32>()))), addresses.destination);
+    TAILCALL return continue_(HANDLER_PARAMS(DECOMPOSE_PARAMS_NAME_ONLY));
+}
+
+HANDLE_INSTRUCTION(synthetic_i32_mul2local)
+{
+    configuration.push_to_destination(Value(static_cast<i32>(Operators::Multiply {}(configuration.local(instruction->local_index()).to<u32>(), configuration.local(instruction->arguments().get<LocalIndex>()).to<u32>()))), addresses.destination);
+    TAILCALL return continue_(HANDLER_PARAMS(DECOMPOSE_PARAMS_NAME_ONLY));
+}
+
+HANDLE_INSTRUCTION(synthetic_i64_add2local)
+{
+    configuration.push_to_destination(Value(static_cast<i64>(Operators::Add {}(configuration.local(instruction->local_index()).to<u64>(), configuration.local(instruction->arguments().get<LocalIndex>()).to<u64>()))), addresses.destination);
+    TAILCALL return continue_(HANDLER_PARAMS(DECOMPOSE_PARAMS_NAME_ONLY));
+}
+
 HANDLE_INSTRUCTION(synthetic_i32_addconstlocal)
 {
     configuration.push_to_destination(Value(static_cast<i32>(Operators::Add {}(configuration.local(instruction->local_index()).to<u32>(), instruction->arguments().unsafe_get<i32>()))), addresses.destination);
@@ -3626,7 +3656,7 @@ constexpr static auto handle_instruction(Args&&... a)
     return InstructionHandler<opcode>::template operator()<HasDynamicInsnLimit, Continue>(forward<Args>(a)...);
 }
 
-template<bool HasCompiledList, bool HasDynamicInsnLimit, bool HaveDirectThreadingInfo>
+template<bool HasCompiledList, bool HasDynamicInsnLimit, bool HaveDirectThreadingInfo, bool CountOpcodes>
 FLATTEN void BytecodeInterpreter::interpret_impl(Configuration& configuration, Expression const& expression)
 {
     auto& instructions = expression.instructions();
@@ -3666,6 +3696,9 @@ FLATTEN void BytecodeInterpreter::interpret_impl(Configuration& configuration, E
                 : instruction->opcode())
                                 .value();
 
+        if constexpr (CountOpcodes)
+            m_profiler->count_opcode(opcode);
+
 #define RUN_NEXT_INSTRUCTION() \
     {                          \
         ++current_ip_value;    \
@@ -4036,6 +4069,20 @@ double BytecodeInterpreter::read_value<double>(ReadonlyBytes data)
     return bit_cast<double>(read_value<u64>(data));
 }
 
+// Binary operations that have a fused form taking both of their operands directly from locals.
+static Optional<OpCode> fused_two_local_opcode(OpCode opcode)
+{
+    if (opcode == Instructions::i32_add)
+        return Instructions::synthetic_i32_add2local;
+    if (opcode == Instructions::i32_sub)
+        return Instructions::synthetic_i32_sub2local;
+    if (opcode == Instructions::i32_mul)
+        return Instructions::synthetic_i32_mul2local;
+    if (opcode == Instructions::i64_add)
+        return Instructions::synthetic_i64_add2local;
+    return {};
+}
+
 CompiledInstructions try_compile_instructions(Expression const& expression, Span<FunctionType const> functions)
 {
     CompiledInstructions result;
@@ -4119,13 +4166,13 @@ CompiledInstructions try_compile_instructions(Expression const& expression, Span
             }
             break;
         case InsnPatternState::GetLocalx2:
-            if (instruction.opcode() == Instructions::i32_add) {
-                // `local.get a; local.get b; i32.add` -> `i32.add_2local a b`.
-                // Replace the previous two ops with noops, and add i32.add_2local.
+            if (auto fused_opcode = fused_two_local_opcode(instruction.opcode()); fused_opcode.has_value()) {
+                // `local.get a; local.get b; i32.add` -> `i32.add_2local a b` (and likewise for the other ops in fused_two_local_opcode()).
+                // Replace the previous two ops with noops, and add the fused op.
                 result.dispatches[result.dispatches.size() - 1] = default_dispatch(nop);
                 result.dispatches[result.dispatches.size() - 2] = default_dispatch(nop);
                 result.extra_instruction_storage.append(Instruction {
-                    Instructions::synthetic_i32_add2local,
+                    *fused_opcode,
                     local_index_0,
                     local_index_1,
                 });
@@ -4186,6 +4233,19 @@ CompiledInstructions try_compile_instructions(Expression const& expression, Span
             }
             break;
         case InsnPatternState::GetLocalI32Const:
+            if (instruction.opcode() == Instructions::i32_sub) {
+                // `local.get a; i32.const b; i32.sub` -> `i32.add_constlocal a -b`.
+                result.dispatches[result.dispatches.size() - 1] = default_dispatch(nop);
+                result.dispatches[result.dispatches.size() - 2] = default_dispatch(nop);
+                result.extra_instruction_storage.append(Instruction(
+                    Instructions::synthetic_i32_addconstlocal,
+                    local_index_0,
+                    static_cast<i32>(0u - static_cast<u32>(i32_const_value))));
+
+                result.dispatches.append(default_dispatch(result.extra_instruction_storage.unsafe_last()));
+                pattern_state = InsnPatternState::Nothing;
+                continue;
+            }
             if (instruction.opcode() == Instructions::local_set) {
                 // `i32.const a; local.set b` -> `local.seti32_const b a`.
                 result.dispatches[result.dispatches.size() - 1] = default_dispatch(nop);
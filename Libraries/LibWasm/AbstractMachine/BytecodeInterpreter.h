@@ -61,7 +61,7 @@ struct WASM_API BytecodeInterpreter final : public Interpreter {
         IndirectCall,
     };
 
-    template<bool HasCompiledList, bool HasDynamicInsnLimit, bool HaveDirectThreadingInfo>
+    template<bool HasCompiledList, bool HasDynamicInsnLimit, bool HaveDirectThreadingInfo, bool CountOpcodes = false>
     void interpret_impl(Configuration&, Expression const&);
 
     InstructionPointer branch_to_label(Configuration&, LabelIndex);
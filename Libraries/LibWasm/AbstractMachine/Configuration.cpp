@@ -5,8 +5,10 @@
  */
 
 #include <AK/MemoryStream.h>
+#include <AK/ScopeGuard.h>
 #include <LibWasm/AbstractMachine/Configuration.h>
 #include <LibWasm/AbstractMachine/Interpreter.h>
+#include <LibWasm/AbstractMachine/Profiler.h>
 #include <LibWasm/Printer/Printer.h>
 
 namespace Wasm {
@@ -23,6 +25,15 @@ Result Configuration::call(Interpreter& interpreter, FunctionAddress address, Ve
     auto* function = m_store.get(address);
     if (!function)
         return Trap::from_string("Attempt to call nonexistent function by address");
+
+    auto* profiler = interpreter.profiler();
+    if (profiler) [[unlikely]]
+        profiler->enter_function(address);
+    ScopeGuard exit_profiled_function = [&] {
+        if (profiler) [[unlikely]]
+            profiler->exit_function();
+    };
+
     if (auto* wasm_function = function->get_pointer<WasmFunction>()) {
         Vector<Value> locals = move(arguments);
         locals.ensure_capacity(locals.size() + wasm_function->code().func().locals().size());
@@ -10,6 +10,8 @@
 
 namespace Wasm {
 
+class Profiler;
+
 struct Interpreter {
     virtual ~Interpreter() = default;
     virtual void interpret(Configuration&) = 0;
@@ -17,6 +19,12 @@ struct Interpreter {
     virtual bool did_trap() const = 0;
     virtual void clear_trap() = 0;
     virtual void visit_external_resources(HostVisitOps const&) { }
+
+    Profiler* profiler() const { return m_profiler; }
+    void set_profiler(Profiler* profiler) { m_profiler = profiler; }
+
+protected:
+    Profiler* m_profiler { nullptr };
 };
 
 }
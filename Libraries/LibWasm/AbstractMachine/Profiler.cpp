@@ -0,0 +1,155 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/LEB128.h>
+#include <AK/MemoryStream.h>
+#include <AK/StringBuilder.h>
+#include <LibWasm/AbstractMachine/Profiler.h>
+
+namespace Wasm {
+
+#define M(name, ...)                                                          \
+    static_assert((Instructions::name.value() & 0x00ffffffffffff00ull) == 0); \
+    static_assert(Profiler::opcode_counter_index(Instructions::name) < Profiler::opcode_counter_count);
+ENUMERATE_WASM_OPCODES(M)
+#undef M
+
+void Profiler::enter_function(FunctionAddress address)
+{
+    auto parent = m_active_calls.is_empty() ? 0 : m_active_calls.last().node;
+    size_t node = m_call_tree[parent].children.ensure(address, [&] { return m_call_tree.size(); });
+    if (node == m_call_tree.size())
+        m_call_tree.append({ .function = address, .parent = parent, .children = {}, .self_time = {} });
+
+    ++m_function_statistics.ensure(address).call_count;
+    ++m_active_call_depths.ensure(address);
+    m_active_calls.append({ .node = node, .start = MonotonicTime::now(), .time_in_callees = {} });
+}
+
+void Profiler::exit_function()
+{
+    auto call = m_active_calls.take_last();
+    auto elapsed = MonotonicTime::now() - call.start;
+    auto self_time = elapsed - call.time_in_callees;
+
+    auto& node = m_call_tree[call.node];
+    node.self_time += self_time;
+
+    auto& statistics = m_function_statistics.ensure(node.function);
+    statistics.self_time += self_time;
+
+    // NOTE: Recursive activations are already part of the outermost activation's total time.
+    auto& depth = m_active_call_depths.ensure(node.function);
+    if (--depth == 0) {
+        statistics.total_time += elapsed;
+        m_active_call_depths.remove(node.function);
+    }
+
+    if (!m_active_calls.is_empty())
+        m_active_calls.last().time_in_callees += elapsed;
+}
+
+void Profiler::for_each_call_stack(Function<void(ReadonlySpan<FunctionAddress>, AK::Duration)> const& callback) const
+{
+    Vector<FunctionAddress> stack;
+    auto visit = [&](auto& visit, size_t node_index) -> void {
+        auto& node = m_call_tree[node_index];
+        if (node_index != 0) {
+            stack.append(node.function);
+            if (!node.self_time.is_zero())
+                callback(stack, node.self_time);
+        }
+        for (auto& child : node.children)
+            visit(visit, child.value);
+        if (node_index != 0)
+            stack.take_last();
+    };
+    visit(visit, 0);
+}
+
+void Profiler::for_each_executed_opcode(Function<void(OpCode, u64)> const& callback) const
+{
+#define M(name, ...)                                                                        \
+    if (auto count = m_opcode_counts[opcode_counter_index(Instructions::name)]; count != 0) \
+        callback(Instructions::name, count);
+    ENUMERATE_WASM_OPCODES(M)
+#undef M
+}
+
+ByteString Profiler::collapsed_stacks(HashMap<FunctionAddress, ByteString> const& names) const
+{
+    StringBuilder builder;
+    for_each_call_stack([&](ReadonlySpan<FunctionAddress> stack, AK::Duration self_time) {
+        auto first = true;
+        for (auto address : stack) {
+            if (!first)
+                builder.append(';');
+            first = false;
+            if (auto name = names.get(address); name.has_value())
+                builder.append(name->replace(";"sv, ":"sv));
+            else
+                builder.appendff("#{}", address.value());
+        }
+        builder.appendff(" {}\n", self_time.to_nanoseconds());
+    });
+    return builder.to_byte_string();
+}
+
+// Reads the function names subsection (id 1) of the custom "name" section, if the module has one.
+static ErrorOr<void> parse_function_names(Module const& module, HashMap<u32, ByteString>& names)
+{
+    constexpr u8 function_names_subsection_id = 1;
+    for (auto& section : module.custom_sections()) {
+        if (section.name() != "name"sv)
+            continue;
+        FixedMemoryStream stream { section.contents().bytes() };
+        while (!stream.is_eof()) {
+            auto subsection_id = TRY(stream.read_value<u8>());
+            u32 subsection_size = TRY(stream.read_value<LEB128<u32>>());
+            if (subsection_id != function_names_subsection_id) {
+                TRY(stream.discard(subsection_size));
+                continue;
+            }
+            u32 count = TRY(stream.read_value<LEB128<u32>>());
+            for (u32 i = 0; i < count; ++i) {
+                u32 index = TRY(stream.read_value<LEB128<u32>>());
+                u32 length = TRY(stream.read_value<LEB128<u32>>());
+                auto name = TRY(ByteBuffer::create_uninitialized(length));
+                TRY(stream.read_until_filled(name));
+                names.set(index, ByteString { name.bytes() });
+            }
+        }
+    }
+    return {};
+}
+
+void Profiler::collect_function_names(Module const& module, ModuleInstance const& instance, Store& store, HashMap<FunctionAddress, ByteString>& names)
+{
+    HashMap<u32, ByteString> names_by_index;
+    if (auto result = parse_function_names(module, names_by_index); result.is_error())
+        dbgln("Ignoring malformed name section: {}", result.error());
+
+    for (size_t index = 0; index < instance.functions().size(); ++index) {
+        auto address = instance.functions()[index];
+        if (names.contains(address))
+            continue;
+        if (auto name = names_by_index.get(index); name.has_value()) {
+            names.set(address, *name);
+            continue;
+        }
+        if (auto* host_function = store.get(address)->get_pointer<HostFunction>()) {
+            names.set(address, host_function->name());
+            continue;
+        }
+        auto export_ = instance.exports().find_if([&](auto& entry) { return entry.value() == address; });
+        if (!export_.is_end())
+            names.set(address, export_->name());
+        else
+            names.set(address, ByteString::formatted("func[{}]", index));
+    }
+}
+
+}
@@ -0,0 +1,92 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/Array.h>
+#include <AK/ByteString.h>
+#include <AK/Function.h>
+#include <AK/HashMap.h>
+#include <AK/Time.h>
+#include <AK/Vector.h>
+#include <LibWasm/AbstractMachine/AbstractMachine.h>
+#include <LibWasm/Export.h>
+#include <LibWasm/Opcode.h>
+
+namespace Wasm {
+
+// Records where the time goes while an interpreter runs. Every function call is timed on entry and exit
+// and attributed to its position in a call tree, so that both per-function self/total time and full
+// call stacks can be reported afterwards. Optionally also counts every executed (possibly synthetic) opcode.
+class WASM_API Profiler {
+public:
+    struct FunctionStatistics {
+        u64 call_count { 0 };
+        AK::Duration self_time;
+        AK::Duration total_time;
+    };
+
+    explicit Profiler(bool count_opcodes = false)
+        : m_counts_opcodes(count_opcodes)
+    {
+        m_call_tree.append({ .function = {}, .parent = 0, .children = {}, .self_time = {} });
+    }
+
+    void enter_function(FunctionAddress);
+    void exit_function();
+
+    // NOTE: Every opcode is either a single byte, or a 0xfc/0xfd/0xfe prefix followed by a number below 256.
+    //       So the counters fit into four rows of 256, which is much cheaper to bump than a hash table entry.
+    static constexpr size_t opcode_counter_count = 4 * 256;
+    static constexpr size_t opcode_counter_index(OpCode opcode)
+    {
+        auto prefix = opcode.value() >> 56;
+        auto row = prefix == 0 ? 0 : prefix - 0xfb;
+        return row * 256 + (opcode.value() & 0xff);
+    }
+
+    bool counts_opcodes() const { return m_counts_opcodes; }
+    ALWAYS_INLINE void count_opcode(OpCode opcode) { ++m_opcode_counts[opcode_counter_index(opcode)]; }
+
+    HashMap<FunctionAddress, FunctionStatistics> const& function_statistics() const { return m_function_statistics; }
+
+    // Calls the callback once for every opcode that was executed at least once.
+    void for_each_executed_opcode(Function<void(OpCode, u64 count)> const&) const;
+
+    // Calls the callback once for every distinct call stack (outermost function first) that spent time in its innermost function.
+    void for_each_call_stack(Function<void(ReadonlySpan<FunctionAddress>, AK::Duration self_time)> const&) const;
+
+    // Returns one "outer;...;inner <nanoseconds of self time>" line per call stack, as consumed by flame graph tools.
+    // Functions without an entry in the given names are called #<address>.
+    ByteString collapsed_stacks(HashMap<FunctionAddress, ByteString> const& names) const;
+
+    // Names the functions of a module instance. Names come from the module's "name" section, falling back to host function
+    // names, export names and func[index]. Functions that already have a name are left alone.
+    static void collect_function_names(Module const&, ModuleInstance const&, Store&, HashMap<FunctionAddress, ByteString>& names);
+
+private:
+    struct CallTreeNode {
+        FunctionAddress function;
+        size_t parent { 0 };
+        HashMap<FunctionAddress, size_t> children;
+        AK::Duration self_time;
+    };
+
+    struct ActiveCall {
+        size_t node { 0 };
+        MonotonicTime start;
+        AK::Duration time_in_callees;
+    };
+
+    bool m_counts_opcodes { false };
+    Vector<CallTreeNode> m_call_tree;
+    Vector<ActiveCall> m_active_calls;
+    HashMap<FunctionAddress, size_t> m_active_call_depths;
+    HashMap<FunctionAddress, FunctionStatistics> m_function_statistics;
+    Array<u64, opcode_counter_count> m_opcode_counts {};
+};
+
+}
@@ -5,9 +5,11 @@
  */
 
 #include <AK/HashTable.h>
+#include <AK/OwnPtr.h>
 #include <AK/SourceLocation.h>
 #include <AK/TemporaryChange.h>
 #include <AK/Try.h>
+#include <LibThreading/ParallelChunks.h>
 #include <LibWasm/AbstractMachine/Validator.h>
 #include <LibWasm/Printer/Printer.h>
 
@@ -255,32 +257,78 @@ ErrorOr<void, ValidationError> Validator::validate(TableSection const& section)
 
 ErrorOr<void, ValidationError> Validator::validate(CodeSection const& section)
 {
-    size_t index = m_context.imported_function_count;
-    for (auto& entry : section.functions()) {
-        auto function_index = index++;
-        TRY(validate(FunctionIndex { function_index }));
-        auto& function_type = m_context.functions[function_index];
-        auto& function = entry.func();
-
-        auto function_validator = fork();
-        function_validator.m_context.locals = {};
-        function_validator.m_context.locals.extend(function_type.parameters());
-        for (auto& local : function.locals()) {
-            for (size_t i = 0; i < local.n(); ++i)
-                function_validator.m_context.locals.append(local.type());
+    auto& functions = section.functions();
+
+    // NOTE: Function bodies only depend on the module-level context, so they can be validated (and compiled) independently.
+    //       Handing work to other threads is not free, so only bother for modules with enough functions to make it worthwhile.
+    static constexpr size_t min_functions_per_chunk = 256;
+
+    auto chunk_count = Threading::parallel_chunk_count(functions.size(), min_functions_per_chunk);
+
+    if (chunk_count == 1) {
+        for (size_t i = 0; i < functions.size(); ++i) {
+            auto function_validator = fork();
+            TRY(function_validator.validate_function(m_context.imported_function_count + i, functions[i]));
         }
+        return {};
+    }
 
-        function_validator.m_frames.empend(function_type, FrameKind::Function, (size_t)0);
-        function_validator.m_max_frame_size = max(function_validator.m_max_frame_size, function_validator.m_frames.size());
+    struct Chunk {
+        OwnPtr<Validator> validator;
+        Optional<ValidationError> error;
+    };
+
+    // NOTE: The context is shared between forks through non-atomic reference counts, so all forks are created (and later
+    //       destroyed) on this thread. The worker threads only ever read from the shared parts of their context.
+    Vector<Chunk> chunks;
+    chunks.resize(chunk_count);
+    for (auto& chunk : chunks) {
+        chunk.validator = adopt_own(*new Validator { m_context });
+        chunk.validator->m_context.locals = {};
+    }
+
+    Threading::for_each_chunk_in_parallel(functions.size(), chunk_count, [&](size_t chunk_index, size_t start, size_t end) {
+        auto& chunk = chunks[chunk_index];
+        for (size_t i = start; i < end; ++i) {
+            if (auto result = chunk.validator->validate_function(m_context.imported_function_count + i, functions[i]); result.is_error()) {
+                chunk.error = result.release_error();
+                return;
+            }
+        }
+    });
 
-        auto results = TRY(function_validator.validate(function.body(), function_type.results()));
-        if (results.result_types.size() != function_type.results().size())
-            return Errors::invalid("function result"sv, function_type.results(), results.result_types);
+    // Report the error of the first invalid function, just like the sequential path would.
+    for (auto& chunk : chunks) {
+        if (chunk.error.has_value())
+            return chunk.error.release_value();
     }
 
     return {};
 }
 
+ErrorOr<void, ValidationError> Validator::validate_function(size_t function_index, CodeSection::Code const& entry)
+{
+    TRY(validate(FunctionIndex { function_index }));
+    auto& function_type = m_context.functions[function_index];
+    auto& function = entry.func();
+
+    m_context.locals.clear();
+    m_context.locals.extend(function_type.parameters());
+    for (auto& local : function.locals()) {
+        for (size_t i = 0; i < local.n(); ++i)
+            m_context.locals.append(local.type());
+    }
+
+    m_frames.empend(function_type, FrameKind::Function, (size_t)0);
+    m_max_frame_size = max(m_max_frame_size, m_frames.size());
+
+    auto results = TRY(validate(function.body(), function_type.results()));
+    if (results.result_types.size() != function_type.results().size())
+        return Errors::invalid("function result"sv, function_type.results(), results.result_types);
+
+    return {};
+}
+
 ErrorOr<void, ValidationError> Validator::validate(TableType const& type)
 {
     return validate(type.limits(), (1ull << 32) - 1);
@@ -1254,6 +1254,68 @@ ParseResult<SectionId> SectionId::parse(Stream& stream)
     }
 }
 
+static ParseResult<void> check_section_order(SectionId::SectionIdKind kind, SectionId::SectionIdKind& last_section_id)
+{
+    if (kind == SectionId::SectionIdKind::Custom)
+        return {};
+    if (kind == last_section_id)
+        return ParseError::DuplicateSection;
+    if (kind < last_section_id)
+        return ParseError::SectionOutOfOrder;
+    last_section_id = kind;
+    return {};
+}
+
+static ParseResult<void> parse_section_contents(Module& module, SectionId::SectionIdKind kind, ConstrainedStream& section_stream)
+{
+    switch (kind) {
+    case SectionId::SectionIdKind::Custom:
+        module.custom_sections().append(TRY(CustomSection::parse(section_stream)));
+        break;
+    case SectionId::SectionIdKind::Type:
+        module.type_section() = TRY(TypeSection::parse(section_stream));
+        break;
+    case SectionId::SectionIdKind::Import:
+        module.import_section() = TRY(ImportSection::parse(section_stream));
+        break;
+    case SectionId::SectionIdKind::Function:
+        module.function_section() = TRY(FunctionSection::parse(section_stream));
+        break;
+    case SectionId::SectionIdKind::Table:
+        module.table_section() = TRY(TableSection::parse(section_stream));
+        break;
+    case SectionId::SectionIdKind::Memory:
+        module.memory_section() = TRY(MemorySection::parse(section_stream));
+        break;
+    case SectionId::SectionIdKind::Global:
+        module.global_section() = TRY(GlobalSection::parse(section_stream));
+        break;
+    case SectionId::SectionIdKind::Export:
+        module.export_section() = TRY(ExportSection::parse(section_stream));
+        break;
+    case SectionId::SectionIdKind::Start:
+        module.start_section() = TRY(StartSection::parse(section_stream));
+        break;
+    case SectionId::SectionIdKind::Element:
+        module.element_section() = TRY(ElementSection::parse(section_stream));
+        break;
+    case SectionId::SectionIdKind::Code:
+        module.code_section() = TRY(CodeSection::parse(section_stream));
+        break;
+    case SectionId::SectionIdKind::Data:
+        module.data_section() = TRY(DataSection::parse(section_stream));
+        break;
+    case SectionId::SectionIdKind::DataCount:
+        module.data_count_section() = TRY(DataCountSection::parse(section_stream));
+        break;
+    default:
+        return ParseError::InvalidIndex;
+    }
+    if (section_stream.remaining() != 0)
+        return ParseError::SectionSizeMismatch;
+    return {};
+}
+
 ParseResult<NonnullRefPtr<Module>> Module::parse(Stream& stream)
 {
     ScopeLogger<WASM_BINPARSER_DEBUG> logger("Module"sv);
@@ -1280,59 +1342,183 @@ ParseResult<NonnullRefPtr<Module>> Module::parse(Stream& stream)
         if (section_id.kind() != SectionId::SectionIdKind::Custom && section_id.kind() == last_section_id)
             return ParseError::DuplicateSection;
 
-        switch (section_id.kind()) {
-        case SectionId::SectionIdKind::Custom:
-            module.custom_sections().append(TRY(CustomSection::parse(section_stream)));
-            break;
-        case SectionId::SectionIdKind::Type:
-            module.type_section() = TRY(TypeSection::parse(section_stream));
-            break;
-        case SectionId::SectionIdKind::Import:
-            module.import_section() = TRY(ImportSection::parse(section_stream));
-            break;
-        case SectionId::SectionIdKind::Function:
-            module.function_section() = TRY(FunctionSection::parse(section_stream));
-            break;
-        case SectionId::SectionIdKind::Table:
-            module.table_section() = TRY(TableSection::parse(section_stream));
-            break;
-        case SectionId::SectionIdKind::Memory:
-            module.memory_section() = TRY(MemorySection::parse(section_stream));
-            break;
-        case SectionId::SectionIdKind::Global:
-            module.global_section() = TRY(GlobalSection::parse(section_stream));
-            break;
-        case SectionId::SectionIdKind::Export:
-            module.export_section() = TRY(ExportSection::parse(section_stream));
-            break;
-        case SectionId::SectionIdKind::Start:
-            module.start_section() = TRY(StartSection::parse(section_stream));
-            break;
-        case SectionId::SectionIdKind::Element:
-            module.element_section() = TRY(ElementSection::parse(section_stream));
-            break;
-        case SectionId::SectionIdKind::Code:
-            module.code_section() = TRY(CodeSection::parse(section_stream));
-            break;
-        case SectionId::SectionIdKind::Data:
-            module.data_section() = TRY(DataSection::parse(section_stream));
-            break;
-        case SectionId::SectionIdKind::DataCount:
-            module.data_count_section() = TRY(DataCountSection::parse(section_stream));
-            break;
-        default:
-            return ParseError::InvalidIndex;
+        TRY(parse_section_contents(module, section_id.kind(), section_stream));
+        TRY(check_section_order(section_id.kind(), last_section_id));
+    }
+
+    return module_ptr;
+}
+
+StreamingModuleParser::StreamingModuleParser()
+    : m_module(make_ref_counted<Module>())
+{
+}
+
+ParseResult<void> StreamingModuleParser::append(ReadonlyBytes bytes)
+{
+    if (m_error.has_value())
+        return *m_error;
+
+    if (m_buffer.try_append(bytes).is_error()) {
+        m_error = ParseError::OutOfMemory;
+        return *m_error;
+    }
+
+    while (true) {
+        auto made_progress = parse_next();
+        if (made_progress.is_error()) {
+            m_error = made_progress.release_error();
+            return *m_error;
         }
-        if (section_id.kind() != SectionId::SectionIdKind::Custom) {
-            if (section_id.kind() < last_section_id)
-                return ParseError::SectionOutOfOrder;
-            last_section_id = section_id.kind();
+        if (!made_progress.value())
+            break;
+    }
+
+    // Drop the bytes we're done with, so that only the partially received section (or function body) stays buffered.
+    if (m_offset > 0) {
+        auto remaining = m_buffer.size() - m_offset;
+        __builtin_memmove(m_buffer.data(), m_buffer.data() + m_offset, remaining);
+        m_buffer.resize(remaining);
+        m_offset = 0;
+    }
+
+    return {};
+}
+
+ParseResult<NonnullRefPtr<Module>> StreamingModuleParser::finish()
+{
+    if (m_error.has_value())
+        return *m_error;
+
+    // All input must have been consumed, and we must not be in the middle of a section.
+    if (m_state != State::SectionHeader || !remaining_bytes().is_empty())
+        return ParseError::UnexpectedEof;
+
+    return m_module;
+}
+
+ParseResult<Optional<u32>> StreamingModuleParser::peek_leb128_u32(size_t offset, size_t& encoded_size) const
+{
+    // A LEB128-encoded u32 takes up at most 5 bytes.
+    static constexpr size_t max_encoded_size = 5;
+
+    auto bytes = remaining_bytes();
+    if (offset >= bytes.size())
+        return Optional<u32> {};
+
+    FixedMemoryStream stream { bytes.slice(offset) };
+    auto value_or_error = stream.read_value<LEB128<u32>>();
+    if (value_or_error.is_error()) {
+        if (bytes.size() - offset < max_encoded_size)
+            return Optional<u32> {};
+        return ParseError::ExpectedSize;
+    }
+
+    encoded_size = MUST(stream.tell());
+    return Optional<u32> { value_or_error.release_value() };
+}
+
+ParseResult<bool> StreamingModuleParser::parse_next()
+{
+    auto bytes = remaining_bytes();
+
+    switch (m_state) {
+    case State::Header: {
+        if (bytes.size() < 8)
+            return false;
+        if (bytes.slice(0, 4) != Module::wasm_magic.span())
+            return ParseError::InvalidModuleMagic;
+        if (bytes.slice(4, 4) != Module::wasm_version.span())
+            return ParseError::InvalidModuleVersion;
+        m_offset += 8;
+        m_state = State::SectionHeader;
+        return true;
+    }
+    case State::SectionHeader: {
+        if (bytes.is_empty())
+            return false;
+        size_t size_length = 0;
+        auto section_size = TRY(peek_leb128_u32(1, size_length));
+        if (!section_size.has_value())
+            return false;
+
+        FixedMemoryStream id_stream { bytes.slice(0, 1) };
+        auto section_id = TRY(SectionId::parse(id_stream));
+        m_offset += 1 + size_length;
+        m_current_section_id = section_id.kind();
+        m_current_section_size = *section_size;
+
+        // NOTE: Function bodies make up the bulk of most modules, so we parse them one by one instead of waiting for the
+        //       entire code section to arrive.
+        if (m_current_section_id == SectionId::SectionIdKind::Code) {
+            TRY(check_section_order(m_current_section_id, m_last_section_id));
+            m_state = State::CodeSectionCount;
+        } else {
+            m_state = State::Section;
         }
-        if (section_stream.remaining() != 0)
+        return true;
+    }
+    case State::Section: {
+        if (bytes.size() < m_current_section_size)
+            return false;
+        if (m_current_section_id != SectionId::SectionIdKind::Custom && m_current_section_id == m_last_section_id)
+            return ParseError::DuplicateSection;
+
+        FixedMemoryStream stream { bytes.slice(0, m_current_section_size) };
+        auto section_stream = ConstrainedStream { MaybeOwned<Stream>(stream), m_current_section_size };
+        TRY(parse_section_contents(*m_module, m_current_section_id, section_stream));
+        TRY(check_section_order(m_current_section_id, m_last_section_id));
+        m_offset += m_current_section_size;
+        m_state = State::SectionHeader;
+        return true;
+    }
+    case State::CodeSectionCount: {
+        size_t count_length = 0;
+        auto count = TRY(peek_leb128_u32(0, count_length));
+        if (!count.has_value())
+            return false;
+        if (count_length > m_current_section_size)
             return ParseError::SectionSizeMismatch;
+        m_offset += count_length;
+        m_current_section_size -= count_length;
+        m_remaining_code_entries = *count;
+        // NOTE: Every entry takes up at least one byte, so don't let a bogus count make us allocate more than that.
+        m_code_entries.ensure_capacity(min(m_remaining_code_entries, m_current_section_size));
+        m_state = State::CodeSectionEntry;
+        return true;
     }
+    case State::CodeSectionEntry: {
+        if (m_remaining_code_entries == 0) {
+            if (m_current_section_size != 0)
+                return ParseError::SectionSizeMismatch;
+            m_module->code_section() = CodeSection { move(m_code_entries) };
+            m_state = State::SectionHeader;
+            return true;
+        }
 
-    return module_ptr;
+        size_t size_length = 0;
+        auto entry_size = TRY(peek_leb128_u32(0, size_length));
+        if (!entry_size.has_value())
+            return false;
+        auto total_size = size_length + *entry_size;
+        if (total_size > m_current_section_size)
+            return ParseError::SectionSizeMismatch;
+        if (bytes.size() < total_size)
+            return false;
+
+        FixedMemoryStream stream { bytes.slice(0, total_size) };
+        auto entry_stream = ConstrainedStream { MaybeOwned<Stream>(stream), total_size };
+        m_code_entries.append(TRY(CodeSection::Code::parse(entry_stream)));
+        if (entry_stream.remaining() != 0)
+            return ParseError::SectionSizeMismatch;
+
+        m_offset += total_size;
+        m_current_section_size -= total_size;
+        --m_remaining_code_entries;
+        return true;
+    }
+    }
+    VERIFY_NOT_REACHED();
 }
 
 ByteString parse_error_to_byte_string(ParseError error)
@@ -1163,5 +1163,8 @@ HashMap<Wasm::OpCode, ByteString> Wasm::Names::instruction_names {
     { Instructions::synthetic_call_30, "synthetic:call.30" },
     { Instructions::synthetic_call_31, "synthetic:call.31" },
     { Instructions::synthetic_end_expression, "synthetic:expression.end" },
+    { Instructions::synthetic_i32_sub2local, "synthetic:i32.sub2local" },
+    { Instructions::synthetic_i32_mul2local, "synthetic:i32.mul2local" },
+    { Instructions::synthetic_i64_add2local, "synthetic:i64.add2local" },
 };
 HashMap<ByteString, Wasm::OpCode> Wasm::Names::instructions_by_name;
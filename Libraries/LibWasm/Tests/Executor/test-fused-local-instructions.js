@@ -0,0 +1,81 @@
+// Each of these bodies matches a pattern that gets fused into a single synthetic instruction.
+const functions = {
+    // local.get 0; local.get 1; i32.sub -> synthetic:i32.sub2local
+    sub: { type: 0, body: [0x20, 0x00, 0x20, 0x01, 0x6b] },
+    // local.get 1; local.get 0; i32.sub -> synthetic:i32.sub2local
+    subReversed: { type: 0, body: [0x20, 0x01, 0x20, 0x00, 0x6b] },
+    // local.get 0; local.get 1; i32.mul -> synthetic:i32.mul2local
+    mul: { type: 0, body: [0x20, 0x00, 0x20, 0x01, 0x6c] },
+    // local.get 0; local.get 1; i64.add -> synthetic:i64.add2local
+    add64: { type: 1, body: [0x20, 0x00, 0x20, 0x01, 0x7c] },
+    // local.get 0; i32.const 5; i32.sub -> synthetic:i32.add_const_local(-5)
+    subFive: { type: 2, body: [0x20, 0x00, 0x41, 0x05, 0x6b] },
+    // local.get 0; i32.const -7; i32.sub -> synthetic:i32.add_const_local(7)
+    subMinusSeven: { type: 2, body: [0x20, 0x00, 0x41, 0x79, 0x6b] },
+    // local.get 0; i32.const INT32_MIN; i32.sub -> synthetic:i32.add_const_local(INT32_MIN)
+    subMin: { type: 2, body: [0x20, 0x00, 0x41, 0x80, 0x80, 0x80, 0x80, 0x78, 0x6b] },
+};
+
+const makeModule = () => {
+    const section = (id, contents) => [id, contents.length, ...contents];
+    const names = Object.keys(functions);
+    const exports = [];
+    const bodies = [];
+    names.forEach((name, index) => {
+        exports.push(name.length, ...[...name].map(c => c.charCodeAt(0)), 0x00, index);
+        const body = [0x00, ...functions[name].body, 0x0b];
+        bodies.push(body.length, ...body);
+    });
+    // prettier-ignore
+    return new Uint8Array([
+        0x00, 0x61, 0x73, 0x6d, 0x01, 0x00, 0x00, 0x00,
+        ...section(0x01, [
+            0x03,
+            0x60, 0x02, 0x7f, 0x7f, 0x01, 0x7f,
+            0x60, 0x02, 0x7e, 0x7e, 0x01, 0x7e,
+            0x60, 0x01, 0x7f, 0x01, 0x7f,
+        ]),
+        ...section(0x03, [names.length, ...names.map(name => functions[name].type)]),
+        ...section(0x07, [names.length, ...exports]),
+        ...section(0x0a, [names.length, ...bodies]),
+    ]);
+};
+
+const module = parseWebAssemblyModule(makeModule());
+const call = (name, ...args) => module.invoke(module.getExport(name), ...args);
+
+test("i32.sub of two locals", () => {
+    expect(call("sub", 10, 3)).toBe(7);
+    expect(call("sub", 3, 10)).toBe(-7);
+    expect(call("subReversed", 10, 3)).toBe(-7);
+    expect(call("sub", -2147483648, 1)).toBe(2147483647);
+    expect(call("sub", 2147483647, -1)).toBe(-2147483648);
+});
+
+test("i32.mul of two locals", () => {
+    expect(call("mul", 6, 7)).toBe(42);
+    expect(call("mul", -3, 4)).toBe(-12);
+    expect(call("mul", 65536, 65536)).toBe(0);
+    expect(call("mul", 65537, 65537)).toBe(131073);
+    expect(call("mul", 2147483647, 2)).toBe(-2);
+});
+
+test("i64.add of two locals", () => {
+    expect(call("add64", 1n, 2n)).toBe(3n);
+    expect(call("add64", -5n, 3n)).toBe(-2n);
+    expect(call("add64", 4294967295n, 1n)).toBe(4294967296n);
+    expect(call("add64", 9223372036854775807n, 1n)).toBe(-9223372036854775808n);
+});
+
+test("i32.sub of a local and a constant", () => {
+    expect(call("subFive", 12)).toBe(7);
+    expect(call("subFive", -2147483648)).toBe(2147483643);
+    expect(call("subMinusSeven", 1)).toBe(8);
+    expect(call("subMinusSeven", 2147483647)).toBe(-2147483642);
+
+    // Negating INT32_MIN wraps around to itself, so subtracting it is the same as adding it.
+    expect(call("subMin", 0)).toBe(-2147483648);
+    expect(call("subMin", 1)).toBe(-2147483647);
+    expect(call("subMin", -1)).toBe(2147483647);
+    expect(call("subMin", -2147483648)).toBe(0);
+});
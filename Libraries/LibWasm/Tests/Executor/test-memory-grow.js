@@ -0,0 +1,89 @@
+const pageSize = 65536;
+
+// Builds a module with a memory of one page and the given maximum, exporting grow(delta), size(),
+// load(address) and store(address, value), where loads and stores access single bytes.
+const makeModule = maximumPages => {
+    const limits = maximumPages === undefined ? [0x00, 0x01] : [0x01, 0x01, maximumPages];
+    const name = string => [string.length, ...[...string].map(c => c.charCodeAt(0))];
+    const section = (id, contents) => [id, contents.length, ...contents];
+    // prettier-ignore
+    return new Uint8Array([
+        0x00, 0x61, 0x73, 0x6d, 0x01, 0x00, 0x00, 0x00,
+        ...section(0x01, [
+            0x03,
+            0x60, 0x01, 0x7f, 0x01, 0x7f,
+            0x60, 0x00, 0x01, 0x7f,
+            0x60, 0x02, 0x7f, 0x7f, 0x00,
+        ]),
+        ...section(0x03, [0x04, 0x00, 0x01, 0x00, 0x02]),
+        ...section(0x05, [0x01, ...limits]),
+        ...section(0x07, [
+            0x04,
+            ...name("grow"), 0x00, 0x00,
+            ...name("size"), 0x00, 0x01,
+            ...name("load"), 0x00, 0x02,
+            ...name("store"), 0x00, 0x03,
+        ]),
+        ...section(0x0a, [
+            0x04,
+            0x06, 0x00, 0x20, 0x00, 0x40, 0x00, 0x0b,
+            0x04, 0x00, 0x3f, 0x00, 0x0b,
+            0x07, 0x00, 0x20, 0x00, 0x2d, 0x00, 0x00, 0x0b,
+            0x09, 0x00, 0x20, 0x00, 0x20, 0x01, 0x3a, 0x00, 0x00, 0x0b,
+        ]),
+    ]);
+};
+
+const instantiate = maximumPages => {
+    const module = parseWebAssemblyModule(makeModule(maximumPages));
+    const exported = name => {
+        const exportedFunction = module.getExport(name);
+        return (...args) => module.invoke(exportedFunction, ...args);
+    };
+    return {
+        grow: exported("grow"),
+        size: exported("size"),
+        load: exported("load"),
+        store: exported("store"),
+    };
+};
+
+// Grows the memory from 1 to 40 pages in steps, crossing the 16 page mark where a memory with a
+// maximum reserves all of it. After each step, the old contents must be kept and the new pages
+// must be zeroed.
+const growFromOneToFortyPages = ({ grow, size, load, store }) => {
+    let pages = 1;
+    for (const delta of [3, 12, 1, 15, 8]) {
+        const oldSize = pages * pageSize;
+        store(0, 0x11);
+        store(oldSize - 1, 0x22);
+
+        expect(grow(delta)).toBe(pages);
+        pages += delta;
+        expect(size()).toBe(pages);
+
+        expect(load(0)).toBe(0x11);
+        expect(load(oldSize - 1)).toBe(0x22);
+        for (const address of [oldSize, oldSize + 1, oldSize + pageSize / 2, pages * pageSize - 1])
+            expect(load(address)).toBe(0);
+    }
+};
+
+test("memory.grow without a maximum", () => {
+    const memory = instantiate();
+    growFromOneToFortyPages(memory);
+    expect(memory.size()).toBe(40);
+});
+
+test("memory.grow up to a maximum", () => {
+    const memory = instantiate(48);
+    growFromOneToFortyPages(memory);
+
+    expect(memory.grow(9)).toBe(-1);
+    expect(memory.size()).toBe(40);
+    expect(memory.grow(8)).toBe(40);
+    expect(memory.size()).toBe(48);
+    expect(memory.load(48 * pageSize - 1)).toBe(0);
+    expect(memory.grow(1)).toBe(-1);
+    expect(memory.size()).toBe(48);
+});
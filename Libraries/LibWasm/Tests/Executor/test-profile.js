@@ -0,0 +1,78 @@
+// Builds a module where run() calls helper() three times, and helper() calls leaf(), which increments a global.
+// The name section names leaf and run ("main"), helper is only named by its export.
+const makeModule = () => {
+    const name = string => [string.length, ...[...string].map(c => c.charCodeAt(0))];
+    const section = (id, contents) => [id, contents.length, ...contents];
+    const functionNames = [0x02, 0x00, ...name("leaf"), 0x02, ...name("main")];
+    // prettier-ignore
+    return new Uint8Array([
+        0x00, 0x61, 0x73, 0x6d, 0x01, 0x00, 0x00, 0x00,
+        ...section(0x01, [0x01, 0x60, 0x00, 0x00]),
+        ...section(0x03, [0x03, 0x00, 0x00, 0x00]),
+        ...section(0x06, [0x01, 0x7f, 0x01, 0x41, 0x00, 0x0b]),
+        ...section(0x07, [
+            0x03,
+            ...name("run"), 0x00, 0x02,
+            ...name("helper"), 0x00, 0x01,
+            ...name("counter"), 0x03, 0x00,
+        ]),
+        ...section(0x0a, [
+            0x03,
+            0x09, 0x00, 0x23, 0x00, 0x41, 0x01, 0x6a, 0x24, 0x00, 0x0b,
+            0x04, 0x00, 0x10, 0x00, 0x0b,
+            0x08, 0x00, 0x10, 0x01, 0x10, 0x01, 0x10, 0x01, 0x0b,
+        ]),
+        ...section(0x00, [...name("name"), ...section(0x01, functionNames)]),
+    ]);
+};
+
+const stacksOf = collapsedStacks =>
+    collapsedStacks
+        .trim()
+        .split("\n")
+        .map(line => {
+            const [, stack, selfTime] = line.match(/^(.*) (\d+)$/);
+            expect(Number(selfTime)).toBeGreaterThan(0);
+            return stack;
+        })
+        .sort();
+
+test("call counts and collapsed stacks", () => {
+    const module = parseWebAssemblyModule(makeModule());
+    const run = module.getExport("run");
+
+    module.invoke(run);
+    startWebAssemblyProfile(false);
+    module.invoke(run);
+    const profile = stopWebAssemblyProfile(module);
+    module.invoke(run);
+
+    expect(profile.calls).toEqual({ main: 1, helper: 3, leaf: 3 });
+    expect(stacksOf(profile.collapsedStacks)).toEqual(["main", "main;helper", "main;helper;leaf"]);
+    expect(Object.keys(profile.opcodes)).toHaveLength(0);
+    expect(module.getExport("counter")).toBe(9);
+});
+
+test("opcode counts", () => {
+    const module = parseWebAssemblyModule(makeModule());
+    const run = module.getExport("run");
+
+    startWebAssemblyProfile(true);
+    module.invoke(run);
+    module.invoke(run);
+    const profile = stopWebAssemblyProfile(module);
+
+    expect(profile.calls).toEqual({ main: 2, helper: 6, leaf: 6 });
+    expect(profile.opcodes["global.get"]).toBe(6);
+    expect(profile.opcodes["global.set"]).toBe(6);
+    expect(profile.opcodes["i32.const"]).toBe(6);
+    expect(profile.opcodes["i32.add"]).toBe(6);
+    // NOTE: Calls to functions with few parameters and results are compiled to synthetic instructions.
+    expect(profile.opcodes["synthetic:call.00"]).toBe(12);
+    expect(profile.opcodes["call"]).toBeUndefined();
+});
+
+test("stopping without a running profile throws", () => {
+    const module = parseWebAssemblyModule(makeModule());
+    expect(() => stopWebAssemblyProfile(module)).toThrowWithMessage(TypeError, "No profile is running");
+});
@@ -0,0 +1,142 @@
+const header = [0x00, 0x61, 0x73, 0x6d, 0x01, 0x00, 0x00, 0x00];
+
+const leb128 = value => {
+    const bytes = [];
+    do {
+        let byte = value & 0x7f;
+        value >>>= 7;
+        if (value !== 0) byte |= 0x80;
+        bytes.push(byte);
+    } while (value !== 0);
+    return bytes;
+};
+
+const section = (id, contents) => [id, ...leb128(contents.length), ...contents];
+
+// A module with function and code sections whose sizes take more than one byte to encode.
+const makeModuleWithManyFunctions = () => {
+    const functionCount = 300;
+    const bodies = [];
+    for (let i = 0; i < functionCount; ++i) {
+        const body = [0x01, 0x02, 0x7f, 0x41, i % 64, 0x21, 0x00, 0x20, 0x01, 0x1a, 0x0b];
+        bodies.push(...leb128(body.length), ...body);
+    }
+    return new Uint8Array([
+        ...header,
+        ...section(0x01, [0x01, 0x60, 0x00, 0x00]),
+        ...section(0x03, [...leb128(functionCount), ...new Array(functionCount).fill(0x00)]),
+        ...section(0x00, [0x04, ..."note".split("").map(c => c.charCodeAt(0)), 0x2a]),
+        ...section(0x0a, [...leb128(functionCount), ...bodies]),
+    ]);
+};
+
+const modules = [
+    readBinaryWasmFile("Fixtures/Modules/empty-module.wasm"),
+    readBinaryWasmFile("Fixtures/Modules/memfill-memidx.wasm"),
+    readBinaryWasmFile("Fixtures/Modules/memory_fill-order.wasm"),
+    readBinaryWasmFile("CI/ci-sanity-check.wasm"),
+    makeModuleWithManyFunctions(),
+];
+
+// The offsets at which a section starts, or the module ends.
+const sectionBoundaries = bytes => {
+    const boundaries = new Set([header.length]);
+    let offset = header.length;
+    while (offset < bytes.length) {
+        let size = 0;
+        let shift = 0;
+        let byte;
+        ++offset;
+        do {
+            byte = bytes[offset++];
+            size |= (byte & 0x7f) << shift;
+            shift += 7;
+        } while (byte & 0x80);
+        offset += size;
+        boundaries.add(offset);
+    }
+    return boundaries;
+};
+
+test("streaming single bytes gives the same module as parsing in one go", () => {
+    for (const bytes of modules)
+        expect(printWebAssemblyModule(bytes, [1])).toBe(printWebAssemblyModule(bytes));
+});
+
+test("streaming random chunks gives the same module as parsing in one go", () => {
+    let seed = 42;
+    const random = max => {
+        seed = (Math.imul(seed, 1103515245) + 12345) >>> 0;
+        return 1 + ((seed >>> 16) % max);
+    };
+
+    for (const bytes of modules) {
+        const expected = printWebAssemblyModule(bytes);
+        for (let i = 0; i < 10; ++i) {
+            const chunkSizes = Array.from({ length: 16 }, () => random(64));
+            expect(printWebAssemblyModule(bytes, chunkSizes)).toBe(expected);
+        }
+    }
+});
+
+test("truncated modules", () => {
+    for (const bytes of modules.slice(0, 3)) {
+        const boundaries = sectionBoundaries(bytes);
+        for (let length = 0; length < bytes.length; ++length) {
+            const truncated = bytes.slice(0, length);
+            if (boundaries.has(length)) {
+                expect(printWebAssemblyModule(truncated, [1])).toBe(
+                    printWebAssemblyModule(truncated)
+                );
+                continue;
+            }
+            for (const chunkSizes of [[1], [length || 1]]) {
+                expect(() => printWebAssemblyModule(truncated, chunkSizes)).toThrowWithMessage(
+                    SyntaxError,
+                    "Unexpected end-of-file"
+                );
+            }
+        }
+    }
+});
+
+const expectStreamingError = (sections, message) => {
+    const bytes = new Uint8Array([...header, ...sections]);
+    for (const chunkSizes of [[1], [3], [bytes.length]]) {
+        expect(() => printWebAssemblyModule(bytes, chunkSizes)).toThrowWithMessage(
+            SyntaxError,
+            message
+        );
+    }
+};
+
+test("sections out of order", () => {
+    const message = "A section encountered was not in the correct ordering";
+    expectStreamingError([...section(0x03, [0x00]), ...section(0x01, [0x00])], message);
+    expectStreamingError([...section(0x0a, [0x00]), ...section(0x03, [0x00])], message);
+});
+
+test("duplicate sections", () => {
+    const message = "Two sections of the same type were encountered";
+    expectStreamingError([...section(0x01, [0x00]), ...section(0x01, [0x00])], message);
+    expectStreamingError([...section(0x0a, [0x00]), ...section(0x0a, [0x00])], message);
+
+    // Custom sections may appear any number of times.
+    const custom = section(0x00, [0x01, 0x61]);
+    const bytes = new Uint8Array([...header, ...custom, ...custom]);
+    expect(printWebAssemblyModule(bytes, [1])).toBe(printWebAssemblyModule(bytes));
+});
+
+test("code section size mismatch", () => {
+    const message = "A parsed section did not fulfill its expected size";
+    const body = [0x02, 0x00, 0x0b];
+
+    // The section is larger than its entries.
+    expectStreamingError([0x0a, 0x05, 0x01, ...body, 0x00], message);
+
+    // An entry is larger than the rest of the section.
+    expectStreamingError([0x0a, 0x03, 0x01, ...body], message);
+
+    // The entry count doesn't fit in the section.
+    expectStreamingError([0x0a, 0x00, 0x01], message);
+});
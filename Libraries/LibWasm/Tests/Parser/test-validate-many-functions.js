@@ -0,0 +1,47 @@
+const leb128 = value => {
+    const bytes = [];
+    do {
+        let byte = value & 0x7f;
+        value >>>= 7;
+        if (value !== 0) byte |= 0x80;
+        bytes.push(byte);
+    } while (value !== 0);
+    return bytes;
+};
+
+const header = [0x00, 0x61, 0x73, 0x6d, 0x01, 0x00, 0x00, 0x00];
+
+const section = (id, contents) => [id, ...leb128(contents.length), ...contents];
+
+// Builds a module with functionCount functions of type [] -> [i32], where function i returns
+// i % 64. The function at invalidIndex returns nothing instead, which makes the module invalid.
+const makeModule = (functionCount, invalidIndex = -1) => {
+    const types = section(1, [0x01, 0x60, 0x00, 0x01, 0x7f]);
+    const typeIndices = new Array(functionCount).fill(0x00);
+    const functions = section(3, [...leb128(functionCount), ...typeIndices]);
+    const name = [..."last"].map(c => c.charCodeAt(0));
+    const exports = section(7, [0x01, name.length, ...name, 0x00, ...leb128(functionCount - 1)]);
+    const bodies = [];
+    for (let i = 0; i < functionCount; ++i) {
+        if (i === invalidIndex) bodies.push(0x02, 0x00, 0x0b);
+        else bodies.push(0x04, 0x00, 0x41, i % 64, 0x0b);
+    }
+    const code = section(10, [...leb128(functionCount), ...bodies]);
+    return new Uint8Array([...header, ...types, ...functions, ...exports, ...code]);
+};
+
+const functionCount = 1000;
+
+test("validating a module with many functions", () => {
+    const module = parseWebAssemblyModule(makeModule(functionCount));
+    expect(module.invoke(module.getExport("last"))).toBe((functionCount - 1) % 64);
+});
+
+test("an invalid function anywhere in a module with many functions fails validation", () => {
+    for (const invalidIndex of [0, 255, 256, 511, 700, functionCount - 1]) {
+        expect(() => parseWebAssemblyModule(makeModule(functionCount, invalidIndex))).toThrow(
+            TypeError,
+            "Validation failed"
+        );
+    }
+});
@@ -7,6 +7,7 @@
 #pragma once
 
 #include <AK/Badge.h>
+#include <AK/ByteBuffer.h>
 #include <AK/ByteString.h>
 #include <AK/DistinctNumeric.h>
 #include <AK/LEB128.h>
@@ -1114,6 +1115,41 @@ private:
     Optional<ByteString> m_validation_error;
 };
 
+// Parses a module from a sequence of chunks, e.g. while it is still being downloaded.
+// Sections are parsed as soon as they have fully arrived, and function bodies in the code section are parsed one at a time.
+class WASM_API StreamingModuleParser {
+public:
+    StreamingModuleParser();
+
+    ParseResult<void> append(ReadonlyBytes);
+    ParseResult<NonnullRefPtr<Module>> finish();
+
+private:
+    enum class State {
+        Header,
+        SectionHeader,
+        Section,
+        CodeSectionCount,
+        CodeSectionEntry,
+    };
+
+    ParseResult<bool> parse_next();
+    ParseResult<Optional<u32>> peek_leb128_u32(size_t offset, size_t& encoded_size) const;
+    ReadonlyBytes remaining_bytes() const { return m_buffer.bytes().slice(m_offset); }
+
+    State m_state { State::Header };
+    ByteBuffer m_buffer;
+    size_t m_offset { 0 };
+    Optional<ParseError> m_error;
+
+    NonnullRefPtr<Module> m_module;
+    SectionId::SectionIdKind m_last_section_id { SectionId::SectionIdKind::Custom };
+    SectionId::SectionIdKind m_current_section_id { SectionId::SectionIdKind::Custom };
+    size_t m_current_section_size { 0 };
+    size_t m_remaining_code_entries { 0 };
+    Vector<CodeSection::Code> m_code_entries;
+};
+
 CompiledInstructions try_compile_instructions(Expression const&, Span<FunctionType const> functions);
 
 }
@@ -216,6 +216,13 @@ void EventLoop::process()
         for (auto& win : same_loop_windows()) {
             win->start_an_idle_period();
         }
+
+        // OPTIMIZATION: Use the rest of the idle period to collect garbage before the allocation threshold forces a
+        //               collection in the middle of a task or a rendering update. Idle callbacks that were just
+        //               queued take precedence.
+        auto remaining_idle_time = compute_deadline() - HighResolutionTime::unsafe_shared_current_time();
+        if (remaining_idle_time > 0 && !m_task_queue->has_runnable_tasks())
+            heap().collect_garbage_if_idle_time_allows(AK::Duration::from_milliseconds(static_cast<i64>(remaining_idle_time)));
     }
 
     // If there are eligible tasks in the queue, schedule a new round of processing. :^)
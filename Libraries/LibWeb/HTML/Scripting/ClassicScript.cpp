@@ -18,9 +18,14 @@ namespace Web::HTML {
 
 GC_DEFINE_ALLOCATOR(ClassicScript);
 
+GC::Ref<ClassicScript> ClassicScript::create(ByteString filename, StringView source, JS::Realm& realm, URL::URL base_url, size_t source_line_number, MutedErrors muted_errors)
+{
+    return create(move(filename), Utf16String::from_utf8_with_replacement_character(source, Utf16String::WithBOMHandling::No), realm, move(base_url), source_line_number, muted_errors);
+}
+
 // https://html.spec.whatwg.org/multipage/webappapis.html#creating-a-classic-script
 // https://whatpr.org/html/9893/webappapis.html#creating-a-classic-script
-GC::Ref<ClassicScript> ClassicScript::create(ByteString filename, StringView source, JS::Realm& realm, URL::URL base_url, size_t source_line_number, MutedErrors muted_errors)
+GC::Ref<ClassicScript> ClassicScript::create(ByteString filename, Utf16String source, JS::Realm& realm, URL::URL base_url, size_t source_line_number, MutedErrors muted_errors)
 {
     auto& vm = realm.vm();
 
@@ -30,7 +35,7 @@ GC::Ref<ClassicScript> ClassicScript::create(ByteString filename, StringView sou
 
     // 2. If scripting is disabled for realm, then set source to the empty string.
     if (is_scripting_disabled(realm))
-        source = ""sv;
+        source = Utf16String {};
 
     // 3. Let script be a new classic script that this algorithm will subsequently initialize.
     // 4. Set script's realm to realm.
@@ -50,7 +55,7 @@ GC::Ref<ClassicScript> ClassicScript::create(ByteString filename, StringView sou
 
     // 10. Let result be ParseScript(source, realm, script).
     auto parse_timer = Core::ElapsedTimer::start_new();
-    auto result = JS::Script::parse(source, realm, script->filename(), script, source_line_number);
+    auto result = JS::Script::parse(move(source), realm, script->filename(), script, source_line_number);
     dbgln_if(HTML_SCRIPT_DEBUG, "ClassicScript: Parsed {} in {}ms", script->filename(), parse_timer.elapsed_milliseconds());
 
     // 11. If result is a list of errors, then:
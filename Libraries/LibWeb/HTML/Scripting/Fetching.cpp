@@ -10,6 +10,7 @@
 #include <LibGC/Function.h>
 #include <LibJS/Runtime/ModuleRequest.h>
 #include <LibTextCodec/Decoder.h>
+#include <LibThreading/BackgroundAction.h>
 #include <LibWeb/Bindings/MainThreadVM.h>
 #include <LibWeb/Bindings/PrincipalHostDefined.h>
 #include <LibWeb/DOM/Document.h>
@@ -264,6 +265,15 @@ Optional<URL::URL> resolve_url_like_module_specifier(StringView specifier, URL::
     return url;
 }
 
+// Classic scripts at least this large have their body decoded on a background thread.
+static constexpr size_t minimum_classic_script_size_for_background_decoding = 64 * KiB;
+
+static Utf16String decode_classic_script_source_text(TextCodec::Decoder& fallback_decoder, ByteBuffer const& body_bytes)
+{
+    auto source_text = TextCodec::convert_input_to_utf8_using_given_decoder_unless_there_is_a_byte_order_mark(fallback_decoder, body_bytes).release_value_but_fixme_should_propagate_errors();
+    return Utf16String::from_utf8(source_text);
+}
+
 // https://html.spec.whatwg.org/multipage/webappapis.html#set-up-the-classic-script-request
 static void set_up_classic_script_request(Fetch::Infrastructure::Request& request, ScriptFetchOptions const& options)
 {
@@ -370,19 +380,51 @@ WebIDL::ExceptionOr<void> fetch_classic_script(GC::Ref<HTMLScriptElement> elemen
         auto fallback_decoder = TextCodec::decoder_for(extracted_character_encoding);
         VERIFY(fallback_decoder.has_value());
 
-        auto source_text = TextCodec::convert_input_to_utf8_using_given_decoder_unless_there_is_a_byte_order_mark(*fallback_decoder, body_bytes.template get<ByteBuffer>()).release_value_but_fixme_should_propagate_errors();
+        auto& body = body_bytes.template get<ByteBuffer>();
 
         // 6. Let muted errors be true if response was CORS-cross-origin, and false otherwise.
         auto muted_errors = response->is_cors_cross_origin() ? ClassicScript::MutedErrors::Yes : ClassicScript::MutedErrors::No;
 
-        // 7. Let script be the result of creating a classic script given source text, settings object's realm, response's URL,
-        //    options, and muted errors.
-        // FIXME: Pass options.
         auto response_url = response->url().value_or({});
-        auto script = ClassicScript::create(response_url.to_byte_string(), source_text, settings_object.realm(), response_url, 1, muted_errors);
 
-        // 8. Run onComplete given script.
-        on_complete->function()(script);
+        if (body.size() < minimum_classic_script_size_for_background_decoding) {
+            auto source_text = decode_classic_script_source_text(*fallback_decoder, body);
+
+            // 7. Let script be the result of creating a classic script given source text, settings object's realm, response's URL,
+            //    options, and muted errors.
+            // FIXME: Pass options.
+            auto script = ClassicScript::create(response_url.to_byte_string(), move(source_text), settings_object.realm(), response_url, 1, muted_errors);
+
+            // 8. Run onComplete given script.
+            on_complete->function()(script);
+            return;
+        }
+
+        // OPTIMIZATION: Decoding a large script body and converting it to UTF-16 for the JS lexer doesn't need to block the
+        //               main thread, so we do that on a background thread. Parsing itself still happens on the main thread,
+        //               as the parser interns identifiers and strings in process-wide tables.
+        (void)Threading::BackgroundAction<Utf16String>::construct(
+            [body = move(body), fallback_decoder = &fallback_decoder.value()](auto&) -> ErrorOr<Utf16String> {
+                return decode_classic_script_source_text(*fallback_decoder, body);
+            },
+            [settings_object = GC::make_root(settings_object), on_complete = GC::make_root(on_complete), response_url = move(response_url), muted_errors](Utf16String source_text) mutable -> ErrorOr<void> {
+                auto& realm = settings_object->realm();
+                queue_global_task(Task::Source::Networking, realm.global_object(), GC::create_function(realm.heap(), [&realm, on_complete = GC::Ref { *on_complete }, response_url = move(response_url), muted_errors, source_text = move(source_text)]() mutable {
+                    // 7. Let script be the result of creating a classic script given source text, settings object's realm, response's URL,
+                    //    options, and muted errors.
+                    // FIXME: Pass options.
+                    auto script = ClassicScript::create(response_url.to_byte_string(), move(source_text), realm, response_url, 1, muted_errors);
+
+                    // 8. Run onComplete given script.
+                    on_complete->function()(script);
+                }));
+
+                // NOTE: Release our roots here on the main thread, rather than whenever the BackgroundAction itself is
+                //       destroyed, which may happen on the background thread.
+                settings_object = {};
+                on_complete = {};
+                return {};
+            });
     };
 
     TRY(Fetch::Fetching::fetch(element->realm(), request, Fetch::Infrastructure::FetchAlgorithms::create(vm, move(fetch_algorithms_input))));
@@ -113,6 +113,18 @@ void Internals::gc()
     vm().heap().collect_garbage();
 }
 
+String Internals::dump_heap_snapshot()
+{
+    StringBuilder builder;
+    vm().heap().dump_heap_snapshot(builder);
+    return MUST(builder.to_string());
+}
+
+String Internals::gc_statistics()
+{
+    return vm().heap().statistics().serialized();
+}
+
 WebIDL::ExceptionOr<String> Internals::set_time_zone(StringView time_zone)
 {
     auto current_time_zone = Unicode::current_time_zone();
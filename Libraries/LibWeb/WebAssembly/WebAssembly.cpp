@@ -7,8 +7,10 @@
 
 #include <AK/ByteBuffer.h>
 #include <AK/MemoryStream.h>
+#include <AK/NeverDestroyed.h>
 #include <AK/ScopeGuard.h>
 #include <AK/StringBuilder.h>
+#include <LibCrypto/Hash/SHA2.h>
 #include <LibJS/Runtime/Array.h>
 #include <LibJS/Runtime/ArrayBuffer.h>
 #include <LibJS/Runtime/BigInt.h>
@@ -23,7 +25,10 @@
 #include <LibWeb/Bindings/Intrinsics.h>
 #include <LibWeb/Bindings/ResponsePrototype.h>
 #include <LibWeb/ContentSecurityPolicy/BlockingAlgorithms.h>
+#include <LibWeb/Fetch/Infrastructure/HTTP/Bodies.h>
+#include <LibWeb/Fetch/Infrastructure/NetworkPartitionKey.h>
 #include <LibWeb/Fetch/Response.h>
+#include <LibWeb/HTML/Scripting/Environments.h>
 #include <LibWeb/HTML/Scripting/TemporaryExecutionContext.h>
 #include <LibWeb/Platform/EventLoopPlugin.h>
 #include <LibWeb/WebAssembly/Global.h>
@@ -420,11 +425,110 @@ JS::ThrowCompletionOr<NonnullOwnPtr<Wasm::ModuleInstance>> instantiate_module(JS
 // // https://webassembly.github.io/spec/js-api/#compile-a-webassembly-module
 // https://webassembly.github.io/content-security-policy/js-api/#compile-a-webassembly-module
 JS::ThrowCompletionOr<NonnullRefPtr<CompiledWebAssemblyModule>> compile_a_webassembly_module(JS::VM& vm, ByteBuffer data)
+{
+    // NOTE: Modules that are too large to be cached aren't hashed either, so they don't pay for a digest nobody looks up.
+    Optional<ModuleDigest> digest;
+    if (data.size() <= max_cached_module_byte_size)
+        digest = ::Crypto::Hash::SHA256::hash(data);
+
+    return compile_a_webassembly_module_using_cache(vm, digest, data.size(), [&] {
+        FixedMemoryStream stream { data.bytes() };
+        return Wasm::Module::parse(stream);
+    });
+}
+
+// Keeps recently compiled modules alive, keyed by a digest of their bytes, so that compiling the same bytes again (e.g. after
+// a reload) can skip parsing and validating them. Modules are never modified once they have been validated, so they can be
+// shared between realms.
+//
+// NOTE: A cache hit is much faster than a compile, so entries are partitioned by top-level origin and origin, like the HTTP
+//       cache. Otherwise a page could time compiling some bytes to learn whether another origin in the same process (e.g. a
+//       cross-origin iframe) has compiled them before.
+class CompiledModuleCache {
+public:
+    struct Partition {
+        URL::Origin top_level_origin;
+        URL::Origin origin;
+
+        bool operator==(Partition const&) const = default;
+    };
+
+    RefPtr<CompiledWebAssemblyModule> get(Partition const& partition, ModuleDigest const& digest, size_t byte_size)
+    {
+        for (size_t i = 0; i < m_entries.size(); ++i) {
+            if (m_entries[i].byte_size != byte_size || m_entries[i].digest != digest || m_entries[i].partition != partition)
+                continue;
+
+            // Move the entry to the front, so that the least recently used modules are evicted first.
+            auto entry = m_entries.take(i);
+            auto module = entry.module;
+            m_entries.prepend(move(entry));
+            return module;
+        }
+        return nullptr;
+    }
+
+    void add(Partition partition, ModuleDigest const& digest, size_t byte_size, NonnullRefPtr<CompiledWebAssemblyModule> module)
+    {
+        if (byte_size > max_cached_module_byte_size)
+            return;
+
+        m_entries.prepend({ move(partition), digest, byte_size, move(module) });
+        m_total_byte_size += byte_size;
+
+        while (m_total_byte_size > max_total_byte_size)
+            m_total_byte_size -= m_entries.take_last().byte_size;
+    }
+
+private:
+    // NOTE: This bounds the size of the module binaries we keep compiled modules for, the modules themselves are larger.
+    static constexpr size_t max_total_byte_size = 64 * MiB;
+
+    struct Entry {
+        Partition partition;
+        ModuleDigest digest;
+        size_t byte_size { 0 };
+        NonnullRefPtr<CompiledWebAssemblyModule> module;
+    };
+
+    Vector<Entry> m_entries;
+    size_t m_total_byte_size { 0 };
+};
+
+static CompiledModuleCache& compiled_module_cache()
+{
+    static NeverDestroyed<CompiledModuleCache> cache;
+    return *cache;
+}
+
+static CompiledModuleCache::Partition compiled_module_cache_partition(JS::Realm& realm)
+{
+    auto& settings = HTML::principal_realm_settings_object(HTML::principal_realm(realm));
+    auto network_partition_key = Fetch::Infrastructure::determine_the_network_partition_key(settings);
+    return { move(network_partition_key.top_level_origin), settings.origin() };
+}
+
+JS::ThrowCompletionOr<NonnullRefPtr<CompiledWebAssemblyModule>> compile_a_webassembly_module_using_cache(JS::VM& vm, Optional<ModuleDigest> const& digest, size_t byte_size, Function<Wasm::ParseResult<NonnullRefPtr<Wasm::Module>>()> const& parse)
+{
+    if (!digest.has_value())
+        return compile_a_parsed_webassembly_module(vm, parse());
+
+    auto partition = compiled_module_cache_partition(*vm.current_realm());
+    if (auto compiled_module = compiled_module_cache().get(partition, *digest, byte_size)) {
+        TRY(host_ensure_can_compile_wasm_bytes(vm));
+        get_cache(*vm.current_realm()).add_compiled_module(*compiled_module);
+        return compiled_module.release_nonnull();
+    }
+
+    auto compiled_module = TRY(compile_a_parsed_webassembly_module(vm, parse()));
+    compiled_module_cache().add(move(partition), *digest, byte_size, compiled_module);
+    return compiled_module;
+}
+
+JS::ThrowCompletionOr<NonnullRefPtr<CompiledWebAssemblyModule>> compile_a_parsed_webassembly_module(JS::VM& vm, Wasm::ParseResult<NonnullRefPtr<Wasm::Module>> module_result)
 {
     TRY(host_ensure_can_compile_wasm_bytes(vm));
 
-    FixedMemoryStream stream { data.bytes() };
-    auto module_result = Wasm::Module::parse(stream);
     if (module_result.is_error()) {
         return vm.throw_completion<CompileError>(Wasm::parse_error_to_byte_string(module_result.error()));
     }
@@ -849,6 +953,56 @@ GC::Ref<WebIDL::Promise> instantiate_promise_of_module(JS::VM& vm, GC::Ref<WebID
     return promise;
 }
 
+struct StreamingCompilation : public RefCounted<StreamingCompilation> {
+    Wasm::StreamingModuleParser parser;
+    // NOTE: This is dropped once the body grows past what the module cache keeps.
+    OwnPtr<::Crypto::Hash::SHA256> hasher { ::Crypto::Hash::SHA256::create() };
+    size_t byte_size { 0 };
+};
+
+static void compile_webassembly_response_body_while_streaming(JS::VM& vm, Fetch::Infrastructure::Body& body, GC::Ref<WebIDL::Promise> return_value)
+{
+    auto compilation = make_ref_counted<StreamingCompilation>();
+
+    auto process_body_chunk = GC::create_function(vm.heap(), [compilation](ByteBuffer bytes) {
+        // NOTE: Parse errors are remembered by the parser and reported once the whole body has arrived.
+        (void)compilation->parser.append(bytes);
+        compilation->byte_size += bytes.size();
+        if (compilation->byte_size > Detail::max_cached_module_byte_size)
+            compilation->hasher = nullptr;
+        else if (compilation->hasher)
+            compilation->hasher->update(bytes);
+    });
+
+    auto process_end_of_body = GC::create_function(vm.heap(), [&vm, compilation, return_value]() {
+        auto& realm = HTML::relevant_realm(*return_value->promise());
+        HTML::TemporaryExecutionContext context(realm, HTML::TemporaryExecutionContext::CallbacksEnabled::Yes);
+
+        Optional<Detail::ModuleDigest> digest;
+        if (compilation->hasher)
+            digest = compilation->hasher->digest();
+        auto module_or_error = Detail::compile_a_webassembly_module_using_cache(vm, digest, compilation->byte_size, [&] {
+            return compilation->parser.finish();
+        });
+        if (module_or_error.is_error()) {
+            WebIDL::reject_promise(realm, return_value, module_or_error.error_value());
+            return;
+        }
+
+        auto module_object = realm.create<Module>(realm, module_or_error.release_value());
+        WebIDL::resolve_promise(realm, return_value, module_object);
+    });
+
+    auto process_body_error = GC::create_function(vm.heap(), [return_value](JS::Value reason) {
+        auto& realm = HTML::relevant_realm(*return_value->promise());
+        HTML::TemporaryExecutionContext context(realm);
+        WebIDL::reject_promise(realm, return_value, reason);
+    });
+
+    auto& global_object = HTML::relevant_global_object(*return_value->promise());
+    body.incrementally_read(process_body_chunk, process_end_of_body, process_body_error, GC::Ref<JS::Object> { global_object });
+}
+
 // https://webassembly.github.io/spec/web-api/index.html#compile-a-potential-webassembly-response
 GC::Ref<WebIDL::Promise> compile_potential_webassembly_response(JS::VM& vm, GC::Ref<WebIDL::Promise> source)
 {
@@ -898,6 +1052,14 @@ GC::Ref<WebIDL::Promise> compile_potential_webassembly_response(JS::VM& vm, GC::
             return JS::js_undefined();
         }
 
+        // OPTIMIZATION: Rather than waiting for the entire body to arrive, we hand each chunk to a streaming parser as soon
+        //               as it has been received, so that most of the parsing overlaps with the download.
+        //               This has the same observable behavior as steps 8 and 9 below.
+        if (auto body = response->body(); body && !response_object.is_unusable()) {
+            compile_webassembly_response_body_while_streaming(vm, *body, return_value);
+            return JS::js_undefined();
+        }
+
         // 8. Consume response’s body as an ArrayBuffer, and let bodyPromise be the result.
         auto body_promise_or_error = response_object.array_buffer();
         if (body_promise_or_error.is_error()) {
@@ -592,6 +592,18 @@ void Application::process_did_exit(Process&& process)
     }
 }
 
+void Application::set_system_memory_pressure(GC::MemoryPressure memory_pressure)
+{
+    if (m_system_memory_pressure == memory_pressure)
+        return;
+    m_system_memory_pressure = memory_pressure;
+
+    WebContentClient::for_each_client([&](WebContentClient& client) {
+        client.async_system_memory_pressure_changed(memory_pressure);
+        return IterationDecision::Continue;
+    });
+}
+
 ErrorOr<LexicalPath> Application::path_for_downloaded_file(StringView file) const
 {
     auto downloads_directory = Core::StandardPaths::downloads_directory();
@@ -14,6 +14,7 @@
 #include <LibCore/Forward.h>
 #include <LibDevTools/DevToolsDelegate.h>
 #include <LibDevTools/Forward.h>
+#include <LibGC/MemoryPressure.h>
 #include <LibImageDecoderClient/Client.h>
 #include <LibMain/Main.h>
 #include <LibRequests/RequestClient.h>
@@ -71,6 +72,11 @@ public:
 #endif
     Optional<Process&> find_process(pid_t);
 
+    // Platform front-ends call this when the system reports a change in memory pressure, which is relayed to the
+    // garbage collector of every WebContent process.
+    void set_system_memory_pressure(GC::MemoryPressure);
+    GC::MemoryPressure system_memory_pressure() const { return m_system_memory_pressure; }
+
     ErrorOr<LexicalPath> path_for_downloaded_file(StringView file) const;
 
     virtual void display_download_confirmation_dialog(StringView download_name, LexicalPath const& path) const;
@@ -186,6 +192,7 @@ private:
     OwnPtr<StorageJar> m_storage_jar;
 
     OwnPtr<Core::TimeZoneWatcher> m_time_zone_watcher;
+    GC::MemoryPressure m_system_memory_pressure { GC::MemoryPressure::None };
 
     OwnPtr<Core::EventLoop> m_event_loop;
     OwnPtr<ProcessManager> m_process_manager;
@@ -140,7 +140,13 @@ static ErrorOr<NonnullRefPtr<WebView::WebContentClient>> launch_web_content_proc
     arguments.append("--image-decoder-socket"sv);
     arguments.append(ByteString::number(image_decoder_socket.fd()));
 
-    return launch_server_process<WebView::WebContentClient>("WebContent"sv, move(arguments), forward<ClientArguments>(client_arguments)...);
+    auto client = TRY(launch_server_process<WebView::WebContentClient>("WebContent"sv, move(arguments), forward<ClientArguments>(client_arguments)...));
+
+    // NOTE: A process that starts while the system is low on memory should know about it right away.
+    if (auto memory_pressure = WebView::Application::the().system_memory_pressure(); memory_pressure != GC::MemoryPressure::None)
+        client->async_system_memory_pressure_changed(memory_pressure);
+
+    return client;
 }
 
 ErrorOr<NonnullRefPtr<WebView::WebContentClient>> launch_web_content_process(
@@ -117,6 +117,7 @@ Optional<Process> ProcessManager::remove_process(pid_t pid)
     m_statistics.processes.remove_first_matching([&](auto const& info) {
         return (info->pid == pid);
     });
+    m_gc_statistics.remove(pid);
     return m_processes.take(pid);
 }
 
@@ -126,6 +127,12 @@ void ProcessManager::update_all_process_statistics()
     (void)update_process_statistics(m_statistics);
 }
 
+void ProcessManager::set_gc_statistics(pid_t pid, JsonValue statistics)
+{
+    Threading::MutexLocker locker { m_lock };
+    m_gc_statistics.set(pid, move(statistics));
+}
+
 JsonValue ProcessManager::serialize_json()
 {
     Threading::MutexLocker locker { m_lock };
@@ -146,6 +153,8 @@ JsonValue ProcessManager::serialize_json()
         object.set("pid"sv, process.pid);
         object.set("cpu"sv, process.cpu_percent);
         object.set("memory"sv, process.memory_usage_bytes);
+        if (auto gc_statistics = m_gc_statistics.get(process.pid); gc_statistics.has_value())
+            object.set("gc"sv, *gc_statistics);
         serialized.must_append(move(object));
     });
 
@@ -37,11 +37,15 @@ public:
     void update_all_process_statistics();
     JsonValue serialize_json();
 
+    // Garbage collector statistics most recently reported by a WebContent process.
+    void set_gc_statistics(pid_t, JsonValue);
+
     Function<void(Process&&)> on_process_exited;
 
 private:
     Core::Platform::ProcessStatistics m_statistics;
     HashMap<pid_t, Process> m_processes;
+    HashMap<pid_t, JsonValue> m_gc_statistics;
     [[maybe_unused]] int m_signal_handle { -1 };
     Threading::Mutex m_lock;
 };
@@ -6,6 +6,7 @@
 
 #include <LibWebView/Application.h>
 #include <LibWebView/ProcessManager.h>
+#include <LibWebView/WebContentClient.h>
 #include <LibWebView/WebUI/ProcessesUI.h>
 
 namespace WebView {
@@ -22,6 +23,12 @@ void ProcessesUI::update_process_statistics()
     auto& process_manager = Application::process_manager();
     process_manager.update_all_process_statistics();
 
+    // NOTE: GC statistics arrive asynchronously, so each update shows what WebContent reported for the previous one.
+    WebContentClient::for_each_client([](WebContentClient& client) {
+        client.async_request_gc_statistics_summary();
+        return IterationDecision::Continue;
+    });
+
     async_send_message("loadProcessStatistics"sv, process_manager.serialize_json());
 }
 
@@ -1337,6 +1337,16 @@ void ConnectionFromClient::system_time_zone_changed()
     Unicode::clear_system_time_zone_cache();
 }
 
+void ConnectionFromClient::system_memory_pressure_changed(GC::MemoryPressure memory_pressure)
+{
+    Web::Bindings::main_thread_vm().heap().set_memory_pressure(memory_pressure);
+}
+
+void ConnectionFromClient::request_gc_statistics_summary()
+{
+    async_did_get_gc_statistics_summary(Web::Bindings::main_thread_vm().heap().statistics_summary());
+}
+
 void ConnectionFromClient::cookies_changed(Vector<Web::Cookie::Cookie> cookies)
 {
     for (auto& navigable : Web::HTML::all_navigables()) {
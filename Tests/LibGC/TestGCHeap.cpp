@@ -0,0 +1,356 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/HashTable.h>
+#include <AK/JsonObject.h>
+#include <AK/QuickSort.h>
+#include <LibGC/BlockAllocator.h>
+#include <LibGC/DeferGC.h>
+#include <LibGC/Heap.h>
+#include <LibGC/HeapBlock.h>
+#include <LibGC/HeapBlockIndex.h>
+#include <LibGC/Root.h>
+#include <LibTest/TestCase.h>
+
+namespace {
+
+class TrackedCell final : public GC::Cell {
+    GC_CELL(TrackedCell, GC::Cell);
+
+public:
+    static HashTable<TrackedCell*> s_live_cells;
+
+    explicit TrackedCell(bool must_survive = false)
+        : m_must_survive(must_survive)
+        , m_overrides_must_survive(must_survive)
+    {
+        s_live_cells.set(this);
+        if (must_survive)
+            set_overrides_must_survive_garbage_collection(true);
+    }
+
+    virtual ~TrackedCell() override { s_live_cells.remove(this); }
+
+    virtual bool must_survive_garbage_collection() const override { return m_must_survive; }
+
+    bool overrides_must_survive() const { return m_overrides_must_survive; }
+    void stop_surviving() { m_must_survive = false; }
+
+private:
+    bool m_must_survive { false };
+    bool m_overrides_must_survive { false };
+};
+
+HashTable<TrackedCell*> TrackedCell::s_live_cells;
+
+class PaddedCell final : public GC::Cell {
+    GC_CELL(PaddedCell, GC::Cell);
+
+public:
+    u8 padding[400] {};
+};
+
+class LargeCell final : public GC::Cell {
+    GC_CELL(LargeCell, GC::Cell);
+
+public:
+    u8 padding[2048] {};
+};
+
+class HolderCell final : public GC::Cell {
+    GC_CELL(HolderCell, GC::Cell);
+
+public:
+    Vector<GC::Ref<GC::Cell>> cells;
+
+private:
+    virtual void visit_edges(Visitor& visitor) override
+    {
+        Base::visit_edges(visitor);
+        visitor.visit(cells);
+    }
+};
+
+}
+
+// NOTE: Keeps the cells out of the caller's stack frame, so that conservative stack scanning is less likely to find them.
+static NEVER_INLINE void allocate_cells(GC::Heap& heap, size_t count, bool must_survive)
+{
+    for (size_t i = 0; i < count; ++i)
+        (void)heap.allocate<TrackedCell>(must_survive);
+}
+
+static NEVER_INLINE void allocate_until(GC::Heap& heap, size_t allocated_bytes)
+{
+    while (heap.allocated_bytes_since_last_gc() < allocated_bytes)
+        (void)heap.allocate<PaddedCell>();
+}
+
+static void* allocate_and_touch_block(GC::BlockAllocator& allocator)
+{
+    auto* block = allocator.allocate_block("test");
+    Bytes { block, GC::HeapBlock::block_size }.fill(0xaa);
+    return block;
+}
+
+static NEVER_INLINE void hold_large_cells(GC::Heap& heap, HolderCell& holder, size_t bytes)
+{
+    while (holder.cells.size() * sizeof(LargeCell) < bytes)
+        holder.cells.append(heap.allocate<LargeCell>());
+}
+
+static size_t threshold_for_growth_factor(GC::Heap const& heap, double growth_factor)
+{
+    return static_cast<size_t>(static_cast<double>(heap.live_cell_bytes_after_last_gc()) * growth_factor);
+}
+
+static size_t live_cells_overriding_must_survive_in(GC::HeapBlockBase const* block)
+{
+    size_t count = 0;
+    for (auto* cell : TrackedCell::s_live_cells) {
+        if (cell->overrides_must_survive() && GC::HeapBlockBase::from_cell(cell) == block)
+            ++count;
+    }
+    return count;
+}
+
+TEST_CASE(must_survive_cells_are_counted_per_block)
+{
+    GC::Heap heap(nullptr, [](auto&) { });
+    auto anchor = GC::make_root(heap.allocate<TrackedCell>());
+    auto* block = GC::HeapBlockBase::from_cell(anchor.ptr());
+    EXPECT(!block->has_cells_that_override_must_survive_garbage_collection());
+
+    allocate_cells(heap, 4, true);
+    EXPECT_EQ(TrackedCell::s_live_cells.size(), 5u);
+    EXPECT(live_cells_overriding_must_survive_in(block) > 0);
+    EXPECT(block->has_cells_that_override_must_survive_garbage_collection());
+
+    // Nothing points to the survivors, but they asked to survive.
+    heap.collect_garbage();
+    EXPECT_EQ(TrackedCell::s_live_cells.size(), 5u);
+    EXPECT(block->has_cells_that_override_must_survive_garbage_collection());
+
+    for (auto* cell : TrackedCell::s_live_cells)
+        cell->stop_surviving();
+    heap.collect_garbage();
+    EXPECT(TrackedCell::s_live_cells.contains(anchor.ptr()));
+    EXPECT_EQ(block->has_cells_that_override_must_survive_garbage_collection(), live_cells_overriding_must_survive_in(block) > 0);
+}
+
+TEST_CASE(idle_collection_waits_for_most_of_the_threshold)
+{
+    GC::Heap heap(nullptr, [](auto&) { });
+    auto const plenty_of_time = AK::Duration::from_seconds(60);
+    auto threshold = heap.gc_bytes_threshold();
+
+    EXPECT(!heap.collect_garbage_if_idle_time_allows(plenty_of_time));
+
+    allocate_until(heap, threshold / 2);
+    EXPECT(!heap.collect_garbage_if_idle_time_allows(plenty_of_time));
+    EXPECT_EQ(heap.collection_count(), 0u);
+
+    allocate_until(heap, static_cast<size_t>(static_cast<double>(threshold) * GC::Heap::IDLE_GC_MIN_THRESHOLD_FRACTION));
+    EXPECT(heap.collect_garbage_if_idle_time_allows(plenty_of_time));
+    EXPECT_EQ(heap.collection_count(), 1u);
+    EXPECT_EQ(heap.allocated_bytes_since_last_gc(), 0u);
+}
+
+TEST_CASE(idle_collection_respects_available_time_and_deferral)
+{
+    GC::Heap heap(nullptr, [](auto&) { });
+    heap.collect_garbage();
+    EXPECT(heap.last_collection_duration() > AK::Duration::zero());
+
+    allocate_until(heap, heap.gc_bytes_threshold() - sizeof(PaddedCell));
+    EXPECT(!heap.collect_garbage_if_idle_time_allows(AK::Duration::zero()));
+
+    {
+        GC::DeferGC defer_gc(heap);
+        EXPECT(!heap.collect_garbage_if_idle_time_allows(AK::Duration::from_seconds(60)));
+    }
+    EXPECT_EQ(heap.collection_count(), 1u);
+
+    EXPECT(heap.collect_garbage_if_idle_time_allows(heap.last_collection_duration()));
+    EXPECT_EQ(heap.collection_count(), 2u);
+}
+
+TEST_CASE(marks_are_cleared_in_many_fully_marked_blocks)
+{
+    GC::Heap heap(nullptr, [](auto&) { });
+    auto holder = GC::make_root(heap.allocate<HolderCell>());
+
+    // NOTE: Enough blocks for the sweeper to split them into more than one chunk.
+    HashTable<GC::HeapBlockBase*> blocks;
+    while (blocks.size() <= 2 * 1024) {
+        auto cell = heap.allocate<LargeCell>();
+        holder->cells.append(cell);
+        blocks.set(GC::HeapBlockBase::from_cell(cell.ptr()));
+    }
+
+    for (size_t i = 0; i < 2; ++i) {
+        heap.collect_garbage();
+        for (auto cell : holder->cells)
+            EXPECT(!cell->is_marked());
+        EXPECT(!holder->is_marked());
+    }
+}
+
+TEST_CASE(block_allocator_releases_regions_once_all_their_blocks_are_freed)
+{
+    GC::BlockAllocator allocator;
+
+    // NOTE: Regions start at 16 blocks and double in size, so these come from regions of 16, 32 and 64 blocks.
+    Vector<void*> blocks;
+    for (size_t i = 0; i < 100; ++i)
+        blocks.append(allocate_and_touch_block(allocator));
+    EXPECT_EQ(allocator.region_count(), 3u);
+
+    // The first region still has a block in use, and new blocks are carved from the last one.
+    for (size_t i = 1; i < blocks.size(); ++i)
+        allocator.deallocate_block(blocks[i]);
+    EXPECT_EQ(allocator.region_count(), 2u);
+
+    allocator.deallocate_block(blocks[0]);
+    EXPECT_EQ(allocator.region_count(), 1u);
+
+    // Freed blocks are reused before any new region is reserved.
+    blocks.clear();
+    for (size_t i = 0; i < 64; ++i)
+        blocks.append(allocate_and_touch_block(allocator));
+    EXPECT_EQ(allocator.region_count(), 1u);
+
+    blocks.append(allocate_and_touch_block(allocator));
+    EXPECT_EQ(allocator.region_count(), 2u);
+
+    for (auto* block : blocks)
+        allocator.deallocate_block(block);
+    EXPECT_EQ(allocator.region_count(), 1u);
+}
+
+TEST_CASE(gc_threshold_follows_gc_overhead)
+{
+    GC::Heap heap(nullptr, [](auto&) { });
+    auto holder = GC::make_root(heap.allocate<HolderCell>());
+    hold_large_cells(heap, *holder, 16 * MiB);
+
+    // NOTE: Every collection takes some time, so we always spend more than none of our time collecting garbage.
+    heap.set_target_gc_overhead(0);
+    for (size_t i = 0; i < 5; ++i)
+        heap.collect_garbage();
+    EXPECT(heap.live_cell_bytes_after_last_gc() >= 16 * MiB);
+    EXPECT_EQ(heap.heap_growth_factor(), GC::Heap::MAX_HEAP_GROWTH_FACTOR);
+    EXPECT_EQ(heap.gc_bytes_threshold(), threshold_for_growth_factor(heap, GC::Heap::MAX_HEAP_GROWTH_FACTOR));
+
+    // ...and we never spend more than all of it.
+    heap.set_target_gc_overhead(4);
+    for (size_t i = 0; i < 10; ++i)
+        heap.collect_garbage();
+    EXPECT_EQ(heap.heap_growth_factor(), GC::Heap::MIN_HEAP_GROWTH_FACTOR);
+    EXPECT_EQ(heap.gc_bytes_threshold(), threshold_for_growth_factor(heap, GC::Heap::MIN_HEAP_GROWTH_FACTOR));
+}
+
+TEST_CASE(memory_pressure_limits_heap_growth)
+{
+    GC::Heap heap(nullptr, [](auto&) { });
+    auto holder = GC::make_root(heap.allocate<HolderCell>());
+    hold_large_cells(heap, *holder, 16 * MiB);
+
+    heap.set_target_gc_overhead(0);
+    for (size_t i = 0; i < 5; ++i)
+        heap.collect_garbage();
+    EXPECT_EQ(heap.heap_growth_factor(), GC::Heap::MAX_HEAP_GROWTH_FACTOR);
+
+    auto collection_count = heap.collection_count();
+    heap.set_memory_pressure(GC::MemoryPressure::Moderate);
+    EXPECT_EQ(heap.memory_pressure(), GC::MemoryPressure::Moderate);
+    EXPECT_EQ(heap.collection_count(), collection_count);
+    heap.collect_garbage();
+    EXPECT_EQ(heap.gc_bytes_threshold(), threshold_for_growth_factor(heap, 1.0));
+
+    // Critical pressure collects right away.
+    collection_count = heap.collection_count();
+    heap.set_memory_pressure(GC::MemoryPressure::Critical);
+    EXPECT_EQ(heap.collection_count(), collection_count + 1);
+    EXPECT_EQ(heap.allocated_bytes_since_last_gc(), 0u);
+    EXPECT_EQ(heap.gc_bytes_threshold(), threshold_for_growth_factor(heap, GC::Heap::MIN_HEAP_GROWTH_FACTOR));
+
+    heap.set_memory_pressure(GC::MemoryPressure::None);
+    heap.collect_garbage();
+    EXPECT_EQ(heap.gc_bytes_threshold(), threshold_for_growth_factor(heap, GC::Heap::MAX_HEAP_GROWTH_FACTOR));
+}
+
+TEST_CASE(statistics_summary_leaves_out_the_heap_walk)
+{
+    GC::Heap heap(nullptr, [](auto&) { });
+    heap.collect_garbage();
+
+    auto summary = heap.statistics_summary();
+    auto statistics = heap.statistics();
+    EXPECT_EQ(summary.get_u64("collection_count"sv), 1u);
+    EXPECT(summary.has("live_bytes_after_last_gc"sv));
+    EXPECT(summary.has("last_collection_ms"sv));
+    EXPECT(!summary.has("allocators"sv));
+    EXPECT(statistics.has("allocators"sv));
+    summary.for_each_member([&](auto const& key, auto const&) {
+        EXPECT(statistics.has(key));
+    });
+}
+
+TEST_CASE(block_index_resolves_pointers_into_indexed_blocks_only)
+{
+    GC::Heap heap(nullptr, [](auto&) { });
+    auto holder = GC::make_root(heap.allocate<HolderCell>());
+
+    // NOTE: Large cells get a block each, so this gives us a run of blocks, mostly adjacent ones.
+    Vector<GC::Cell*> cells;
+    for (size_t i = 0; i < 16; ++i) {
+        auto cell = heap.allocate<LargeCell>();
+        holder->cells.append(cell);
+        cells.append(cell.ptr());
+    }
+    quick_sort(cells);
+
+    Vector<GC::HeapBlock*> blocks;
+    for (auto* cell : cells)
+        blocks.append(static_cast<GC::HeapBlock*>(GC::HeapBlockBase::from_cell(cell)));
+
+    GC::HeapBlockIndex index;
+    EXPECT(!index.block_from_possible_pointer(bit_cast<FlatPtr>(blocks.first())));
+
+    // Only every other block goes into the index, so that the others sit between indexed blocks.
+    for (size_t i = 0; i < blocks.size(); i += 2)
+        index.add(*blocks[i]);
+    index.sort();
+    EXPECT_EQ(index.size(), blocks.size() / 2);
+
+    for (size_t i = 0; i < blocks.size(); ++i) {
+        auto block_address = bit_cast<FlatPtr>(blocks[i]);
+        auto* cell = cells[i];
+        auto cell_address = bit_cast<FlatPtr>(cell);
+        if (i % 2 == 0) {
+            EXPECT_EQ(index.block_from_possible_pointer(block_address), blocks[i]);
+            EXPECT_EQ(index.block_from_possible_pointer(block_address + GC::HeapBlock::block_size - 1), blocks[i]);
+            EXPECT_EQ(index.cell_from_possible_pointer(cell_address), cell);
+            EXPECT_EQ(index.cell_from_possible_pointer(cell_address + sizeof(LargeCell) / 2), cell);
+        } else {
+            EXPECT(!index.block_from_possible_pointer(block_address));
+            EXPECT(!index.cell_from_possible_pointer(cell_address));
+        }
+    }
+
+    // Pointers below the first and past the last indexed block.
+    auto first_address = bit_cast<FlatPtr>(blocks.first());
+    auto last_address = bit_cast<FlatPtr>(blocks[blocks.size() - 2]);
+    EXPECT(!index.block_from_possible_pointer(0));
+    EXPECT(!index.block_from_possible_pointer(first_address - 1));
+    EXPECT(!index.block_from_possible_pointer(last_address + GC::HeapBlock::block_size));
+    EXPECT(!index.block_from_possible_pointer(NumericLimits<FlatPtr>::max()));
+
+    index.clear();
+    EXPECT_EQ(index.size(), 0u);
+    EXPECT(!index.block_from_possible_pointer(first_address));
+}
@@ -0,0 +1,106 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/StringBuilder.h>
+#include <LibJS/Lexer.h>
+#include <LibJS/Parser.h>
+#include <LibJS/Runtime/GlobalObject.h>
+#include <LibJS/Runtime/VM.h>
+#include <LibJS/Script.h>
+#include <LibTest/TestCase.h>
+
+// Produces a script of exactly the given length that differs between seeds. It's padded with a comment, so that even
+// long scripts stay cheap to parse.
+static Utf16String make_source(size_t seed, size_t length = JS::VM::minimum_cached_script_source_length)
+{
+    StringBuilder builder;
+    builder.appendff("var seed = {};\n//", seed);
+    VERIFY(builder.length() <= length);
+    builder.append_repeated('x', length - builder.length());
+    return Utf16String::from_utf8(builder.string_view());
+}
+
+static NonnullRefPtr<JS::Program> parse(Utf16String const& source)
+{
+    JS::Parser parser { JS::Lexer(source) };
+    auto program = parser.parse_program();
+    VERIFY(!parser.has_errors());
+    return program;
+}
+
+TEST_CASE(script_parse_reuses_program_for_identical_source)
+{
+    auto vm = JS::VM::create();
+    auto root_execution_context = JS::create_simple_execution_context<JS::GlobalObject>(*vm);
+    auto& realm = *root_execution_context->realm;
+
+    auto source = make_source(0);
+    auto first = JS::Script::parse(source, realm, "test.js"sv);
+    auto second = JS::Script::parse(source, realm, "test.js"sv);
+    EXPECT(!first.is_error());
+    EXPECT(!second.is_error());
+    EXPECT_EQ(&first.value()->parse_node(), &second.value()->parse_node());
+
+    auto different = JS::Script::parse(make_source(1), realm, "test.js"sv);
+    EXPECT(!different.is_error());
+    EXPECT_NE(&first.value()->parse_node(), &different.value()->parse_node());
+}
+
+TEST_CASE(cache_misses_on_different_filename_or_line_offset)
+{
+    auto vm = JS::VM::create();
+    auto source = make_source(0);
+    auto program = parse(source);
+    vm->cache_script_parse_node(source, "a.js"sv, 1, program);
+
+    EXPECT_EQ(vm->find_cached_script_parse_node(source, "a.js"sv, 1), program.ptr());
+    EXPECT(!vm->find_cached_script_parse_node(source, "b.js"sv, 1));
+    EXPECT(!vm->find_cached_script_parse_node(source, "a.js"sv, 2));
+}
+
+TEST_CASE(short_sources_are_not_cached)
+{
+    auto vm = JS::VM::create();
+    auto source = Utf16String::from_utf8("var x = 1;"sv);
+    vm->cache_script_parse_node(source, "a.js"sv, 1, parse(source));
+    EXPECT(!vm->find_cached_script_parse_node(source, "a.js"sv, 1));
+}
+
+TEST_CASE(oldest_entry_is_evicted_past_entry_count)
+{
+    auto vm = JS::VM::create();
+    Vector<Utf16String> sources;
+    for (size_t i = 0; i <= JS::VM::script_parse_node_cache_size; ++i) {
+        sources.append(make_source(i));
+        vm->cache_script_parse_node(sources.last(), "a.js"sv, 1, parse(sources.last()));
+    }
+
+    EXPECT(!vm->find_cached_script_parse_node(sources.first(), "a.js"sv, 1));
+    for (size_t i = 1; i < sources.size(); ++i)
+        EXPECT(vm->find_cached_script_parse_node(sources[i], "a.js"sv, 1));
+}
+
+TEST_CASE(oldest_entries_are_evicted_past_total_source_length)
+{
+    auto vm = JS::VM::create();
+    // NOTE: Two of these fit in the cache, but three don't.
+    auto entry_length = JS::VM::maximum_cached_script_source_length * 2 / 5;
+    Vector<Utf16String> sources;
+    for (size_t i = 0; i < 4; ++i) {
+        sources.append(make_source(i, entry_length));
+        vm->cache_script_parse_node(sources.last(), "a.js"sv, 1, parse(sources.last()));
+    }
+
+    EXPECT(!vm->find_cached_script_parse_node(sources[0], "a.js"sv, 1));
+    EXPECT(!vm->find_cached_script_parse_node(sources[1], "a.js"sv, 1));
+    EXPECT(vm->find_cached_script_parse_node(sources[2], "a.js"sv, 1));
+    EXPECT(vm->find_cached_script_parse_node(sources[3], "a.js"sv, 1));
+
+    auto oversized_source = make_source(4, JS::VM::maximum_cached_script_source_length + 1);
+    vm->cache_script_parse_node(oversized_source, "a.js"sv, 1, parse(oversized_source));
+    EXPECT(!vm->find_cached_script_parse_node(oversized_source, "a.js"sv, 1));
+    EXPECT(vm->find_cached_script_parse_node(sources[3], "a.js"sv, 1));
+}
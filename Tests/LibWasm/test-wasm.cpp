@@ -5,14 +5,21 @@
  */
 
 #include <AK/MemoryStream.h>
+#include <AK/StackInfo.h>
+#include <LibJS/Runtime/AbstractOperations.h>
 #include <LibJS/Runtime/ValueInlines.h>
 #include <LibTest/JavaScriptTestRunner.h>
 #include <LibWasm/AbstractMachine/BytecodeInterpreter.h>
+#include <LibWasm/AbstractMachine/Profiler.h>
+#include <LibWasm/Printer/Printer.h>
 #include <LibWasm/Types.h>
 #include <string.h>
 
 TEST_ROOT("Libraries/LibWasm/Tests");
 
+static StackInfo s_stack_info;
+static OwnPtr<Wasm::Profiler> s_profiler;
+
 TESTJS_GLOBAL_FUNCTION(read_binary_wasm_file, readBinaryWasmFile)
 {
     auto& realm = *vm.current_realm();
@@ -187,6 +194,95 @@ TESTJS_GLOBAL_FUNCTION(parse_webassembly_module, parseWebAssemblyModule)
     return JS::Value(TRY(WebAssemblyModule::create(realm, result.release_value(), imports)));
 }
 
+// Parses a module and returns its textual representation. If an array of chunk sizes is given, the module is fed to the
+// streaming parser in chunks of those sizes (taking turns) instead of being parsed in one go.
+TESTJS_GLOBAL_FUNCTION(print_webassembly_module, printWebAssemblyModule)
+{
+    auto object = TRY(vm.argument(0).to_object(vm));
+    if (!is<JS::Uint8Array>(*object))
+        return vm.throw_completion<JS::TypeError>("Expected a Uint8Array argument to print_webassembly_module"sv);
+    auto bytes = static_cast<JS::Uint8Array&>(*object).data();
+
+    auto parse = [&]() -> JS::ThrowCompletionOr<Wasm::ParseResult<NonnullRefPtr<Wasm::Module>>> {
+        if (vm.argument(1).is_undefined()) {
+            FixedMemoryStream stream { bytes };
+            return Wasm::Module::parse(stream);
+        }
+
+        auto chunk_sizes = TRY(vm.argument(1).to_object(vm));
+        auto chunk_count = TRY(JS::length_of_array_like(vm, *chunk_sizes));
+        if (chunk_count == 0)
+            return vm.throw_completion<JS::RangeError>("Expected at least one chunk size"sv);
+
+        Wasm::StreamingModuleParser parser;
+        size_t offset = 0;
+        for (size_t i = 0; offset < bytes.size(); ++i) {
+            auto chunk_size = TRY(TRY(chunk_sizes->get(i % chunk_count)).to_index(vm));
+            if (chunk_size == 0)
+                return vm.throw_completion<JS::RangeError>("Chunk sizes must not be zero"sv);
+            chunk_size = min(chunk_size, bytes.size() - offset);
+            if (auto result = parser.append(bytes.slice(offset, chunk_size)); result.is_error())
+                return Wasm::ParseResult<NonnullRefPtr<Wasm::Module>> { result.release_error() };
+            offset += chunk_size;
+        }
+        return parser.finish();
+    };
+
+    auto result = TRY(parse());
+    if (result.is_error())
+        return vm.throw_completion<JS::SyntaxError>(Wasm::parse_error_to_byte_string(result.error()));
+
+    AllocatingMemoryStream stream;
+    Wasm::Printer printer { stream };
+    printer.print(*result.value());
+    auto text = TRY_OR_THROW_OOM(vm, stream.read_until_eof());
+    return JS::PrimitiveString::create(vm, TRY_OR_THROW_OOM(vm, String::from_utf8(StringView { text })));
+}
+
+// Starts recording the calls made through module.invoke(). If the argument is true, executed opcodes are counted as well.
+TESTJS_GLOBAL_FUNCTION(start_webassembly_profile, startWebAssemblyProfile)
+{
+    s_profiler = make<Wasm::Profiler>(vm.argument(0).to_boolean());
+    return JS::js_undefined();
+}
+
+// Stops the running profile and returns its call counts, opcode counts and collapsed stacks. Functions are named the same
+// way the wasm utility names them, using the given module's name section and exports.
+TESTJS_GLOBAL_FUNCTION(stop_webassembly_profile, stopWebAssemblyProfile)
+{
+    auto& realm = *vm.current_realm();
+    if (!s_profiler)
+        return vm.throw_completion<JS::TypeError>("No profile is running"sv);
+    auto profiler = s_profiler.release_nonnull();
+
+    auto object = TRY(vm.argument(0).to_object(vm));
+    if (!is<WebAssemblyModule>(*object))
+        return vm.throw_completion<JS::TypeError>("Expected a WebAssemblyModule argument to stop_webassembly_profile"sv);
+    auto& module_object = static_cast<WebAssemblyModule&>(*object);
+
+    HashMap<Wasm::FunctionAddress, ByteString> names;
+    Wasm::Profiler::collect_function_names(module_object.module(), module_object.module_instance(), WebAssemblyModule::machine().store(), names);
+
+    auto calls = JS::Object::create(realm, realm.intrinsics().object_prototype());
+    for (auto& entry : profiler->function_statistics()) {
+        auto name = names.get(entry.key).value_or(ByteString::formatted("#{}", entry.key.value()));
+        calls->define_direct_property(Utf16String::from_utf8(name), JS::Value(static_cast<double>(entry.value.call_count)), JS::default_attributes);
+    }
+
+    auto opcodes = JS::Object::create(realm, realm.intrinsics().object_prototype());
+    profiler->for_each_executed_opcode([&](Wasm::OpCode opcode, u64 count) {
+        opcodes->define_direct_property(Utf16String::from_utf8(Wasm::instruction_name(opcode)), JS::Value(static_cast<double>(count)), JS::default_attributes);
+    });
+
+    auto collapsed_stacks = profiler->collapsed_stacks(names);
+
+    auto result = JS::Object::create(realm, realm.intrinsics().object_prototype());
+    result->define_direct_property("calls"_utf16_fly_string, calls, JS::default_attributes);
+    result->define_direct_property("opcodes"_utf16_fly_string, opcodes, JS::default_attributes);
+    result->define_direct_property("collapsedStacks"_utf16_fly_string, JS::PrimitiveString::create(vm, collapsed_stacks.view()), JS::default_attributes);
+    return result;
+}
+
 TESTJS_GLOBAL_FUNCTION(compare_typed_arrays, compareTypedArrays)
 {
     auto lhs = TRY(vm.argument(0).to_object(vm));
@@ -402,7 +498,13 @@ JS_DEFINE_NATIVE_FUNCTION(WebAssemblyModule::wasm_invoke)
     }
 
     auto functype = WebAssemblyModule::machine().store().get(function_address)->visit([&](auto& func) { return func.type(); });
-    auto result = WebAssemblyModule::machine().invoke(function_address, arguments);
+    auto result = [&] {
+        if (!s_profiler)
+            return WebAssemblyModule::machine().invoke(function_address, arguments);
+        Wasm::BytecodeInterpreter interpreter(s_stack_info);
+        interpreter.set_profiler(s_profiler.ptr());
+        return WebAssemblyModule::machine().invoke(interpreter, function_address, arguments);
+    }();
     if (result.is_trap()) {
         if (auto ptr = result.trap().data.get_pointer<Wasm::ExternallyManagedTrap>())
             return ptr->unsafe_external_object_as<JS::Completion>();
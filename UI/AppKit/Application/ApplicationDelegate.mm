@@ -25,6 +25,10 @@
 
 @property (nonatomic, strong) InfoBar* info_bar;
 
+@property (nonatomic, strong) dispatch_source_t memory_pressure_source;
+
+- (void)observeMemoryPressure;
+
 - (NSMenuItem*)createApplicationMenu;
 - (NSMenuItem*)createFileMenu;
 - (NSMenuItem*)createEditMenu;
@@ -56,6 +60,8 @@
 
         self.managed_tabs = [[NSMutableArray alloc] init];
 
+        [self observeMemoryPressure];
+
         // Reduce the tooltip delay, as the default delay feels quite long.
         [[NSUserDefaults standardUserDefaults] setObject:@100 forKey:@"NSInitialToolTipDelay"];
     }
@@ -148,6 +154,34 @@
 
 #pragma mark - Private methods
 
+- (void)observeMemoryPressure
+{
+    self.memory_pressure_source = dispatch_source_create(
+        DISPATCH_SOURCE_TYPE_MEMORYPRESSURE,
+        0,
+        DISPATCH_MEMORYPRESSURE_NORMAL | DISPATCH_MEMORYPRESSURE_WARN | DISPATCH_MEMORYPRESSURE_CRITICAL,
+        dispatch_get_main_queue());
+
+    __weak ApplicationDelegate* weak_self = self;
+
+    dispatch_source_set_event_handler(self.memory_pressure_source, ^{
+        ApplicationDelegate* self = weak_self;
+        if (self == nil)
+            return;
+
+        auto status = dispatch_source_get_data(self.memory_pressure_source);
+
+        if ((status & DISPATCH_MEMORYPRESSURE_CRITICAL) != 0)
+            WebView::Application::the().set_system_memory_pressure(GC::MemoryPressure::Critical);
+        else if ((status & DISPATCH_MEMORYPRESSURE_WARN) != 0)
+            WebView::Application::the().set_system_memory_pressure(GC::MemoryPressure::Moderate);
+        else
+            WebView::Application::the().set_system_memory_pressure(GC::MemoryPressure::None);
+    });
+
+    dispatch_resume(self.memory_pressure_source);
+}
+
 - (void)openLocation:(id)sender
 {
     auto* current_tab = [NSApp keyWindow];
@@ -17,6 +17,7 @@
 #include <LibJS/Bytecode/BasicBlock.h>
 #include <LibJS/Bytecode/Generator.h>
 #include <LibJS/Bytecode/Interpreter.h>
+#include <LibJS/Bytecode/PassManager.h>
 #include <LibJS/Console.h>
 #include <LibJS/Contrib/Test262/GlobalObject.h>
 #include <LibJS/Parser.h>
@@ -60,6 +61,8 @@ private:
     JS_DECLARE_NATIVE_FUNCTION(save_to_file);
     JS_DECLARE_NATIVE_FUNCTION(load_ini);
     JS_DECLARE_NATIVE_FUNCTION(load_json);
+    JS_DECLARE_NATIVE_FUNCTION(save_heap_snapshot);
+    JS_DECLARE_NATIVE_FUNCTION(gc_statistics);
     JS_DECLARE_NATIVE_FUNCTION(last_value_getter);
     JS_DECLARE_NATIVE_FUNCTION(print);
 };
@@ -78,6 +81,7 @@ public:
 private:
     JS_DECLARE_NATIVE_FUNCTION(load_ini);
     JS_DECLARE_NATIVE_FUNCTION(load_json);
+    JS_DECLARE_NATIVE_FUNCTION(save_heap_snapshot);
     JS_DECLARE_NATIVE_FUNCTION(print);
 };
 
@@ -295,6 +299,23 @@ static JS::ThrowCompletionOr<JS::Value> load_json_impl(JS::VM& vm)
     return JS::JSONObject::parse_json_value(vm, json.value());
 }
 
+static JS::ThrowCompletionOr<JS::Value> save_heap_snapshot_impl(JS::VM& vm)
+{
+    auto filename = TRY(vm.argument(0).to_string(vm));
+
+    StringBuilder builder;
+    vm.heap().dump_heap_snapshot(builder);
+
+    auto file_or_error = Core::File::open(filename, Core::File::OpenMode::Write, 0666);
+    if (file_or_error.is_error())
+        return vm.throw_completion<JS::Error>(TRY_OR_THROW_OOM(vm, String::formatted("Failed to open '{}': {}", filename, file_or_error.error())));
+
+    if (auto result = file_or_error.value()->write_until_depleted(builder.string_view().bytes()); result.is_error())
+        return vm.throw_completion<JS::Error>(TRY_OR_THROW_OOM(vm, String::formatted("Failed to write '{}': {}", filename, result.error())));
+
+    return JS::js_undefined();
+}
+
 void ReplObject::initialize(JS::Realm& realm)
 {
     Base::initialize(realm);
@@ -306,6 +327,8 @@ void ReplObject::initialize(JS::Realm& realm)
     define_native_function(realm, "save"_utf16_fly_string, save_to_file, 1, attr);
     define_native_function(realm, "loadINI"_utf16_fly_string, load_ini, 1, attr);
     define_native_function(realm, "loadJSON"_utf16_fly_string, load_json, 1, attr);
+    define_native_function(realm, "saveHeapSnapshot"_utf16_fly_string, save_heap_snapshot, 1, attr);
+    define_native_function(realm, "gcStatistics"_utf16_fly_string, gc_statistics, 0, attr);
     define_native_function(realm, "print"_utf16_fly_string, print, 1, attr);
 
     define_native_accessor(
@@ -353,11 +376,13 @@ JS_DEFINE_NATIVE_FUNCTION(ReplObject::repl_help)
 {
     warnln("REPL commands:");
     warnln("    exit(code): exit the REPL with specified code. Defaults to 0.");
+    warnln("    gcStatistics(): return an object describing garbage collector timings and heap usage.");
     warnln("    help(): display this menu");
     warnln("    loadINI(file): load the given file as INI.");
     warnln("    loadJSON(file): load the given file as JSON.");
     warnln("    print(value): pretty-print the given JS value.");
     warnln("    save(file): write REPL input history to the given file. For example: save(\"foo.txt\")");
+    warnln("    saveHeapSnapshot(file): write a .heapsnapshot of the GC heap to the given file.");
     return JS::js_undefined();
 }
 
@@ -371,6 +396,16 @@ JS_DEFINE_NATIVE_FUNCTION(ReplObject::load_json)
     return load_json_impl(vm);
 }
 
+JS_DEFINE_NATIVE_FUNCTION(ReplObject::gc_statistics)
+{
+    return JS::JSONObject::parse_json_value(vm, vm.heap().statistics());
+}
+
+JS_DEFINE_NATIVE_FUNCTION(ReplObject::save_heap_snapshot)
+{
+    return save_heap_snapshot_impl(vm);
+}
+
 JS_DEFINE_NATIVE_FUNCTION(ReplObject::print)
 {
     auto result = print_all_arguments(vm);
@@ -388,6 +423,7 @@ void ScriptObject::initialize(JS::Realm& realm)
     u8 attr = JS::Attribute::Configurable | JS::Attribute::Writable | JS::Attribute::Enumerable;
     define_native_function(realm, "loadINI"_utf16_fly_string, load_ini, 1, attr);
     define_native_function(realm, "loadJSON"_utf16_fly_string, load_json, 1, attr);
+    define_native_function(realm, "saveHeapSnapshot"_utf16_fly_string, save_heap_snapshot, 1, attr);
     define_native_function(realm, "print"_utf16_fly_string, print, 1, attr);
 }
 
@@ -401,6 +437,11 @@ JS_DEFINE_NATIVE_FUNCTION(ScriptObject::load_json)
     return load_json_impl(vm);
 }
 
+JS_DEFINE_NATIVE_FUNCTION(ScriptObject::save_heap_snapshot)
+{
+    return save_heap_snapshot_impl(vm);
+}
+
 JS_DEFINE_NATIVE_FUNCTION(ScriptObject::print)
 {
     auto result = print_all_arguments(vm);
@@ -815,6 +856,7 @@ ErrorOr<int> ladybird_main(Main::Arguments arguments)
     bool gc_on_every_allocation = false;
     bool disable_syntax_highlight = false;
     bool disable_debug_printing = false;
+    bool disable_bytecode_optimizations = false;
     bool use_test262_global = false;
     StringView evaluate_script;
     Vector<StringView> script_paths;
@@ -823,6 +865,9 @@ ErrorOr<int> ladybird_main(Main::Arguments arguments)
     args_parser.set_general_help("This is a JavaScript interpreter.");
     args_parser.add_option(s_dump_ast, "Dump the AST", "dump-ast", 'A');
     args_parser.add_option(JS::Bytecode::g_dump_bytecode, "Dump the bytecode", "dump-bytecode", 'd');
+    args_parser.add_option(disable_bytecode_optimizations, "Disable the bytecode optimization passes", "disable-bytecode-optimizations", {});
+    args_parser.add_option(JS::Bytecode::g_dump_bytecode_passes, "Print the block, instruction and register counts before and after each bytecode optimization pass that changed something, and how long it took", "dump-bytecode-passes", {});
+    args_parser.add_option(JS::Bytecode::g_count_bytecode_bigrams, "Count how often each pair of bytecode instructions is dispatched in a row, and print the counts on exit", "count-bytecode-bigrams", {});
     args_parser.add_option(s_as_module, "Treat as module", "as-module", 'm');
     args_parser.add_option(s_print_last_result, "Print last result", "print-last-result", 'l');
     args_parser.add_option(s_strip_ansi, "Disable ANSI colors", "disable-ansi-colors", 'i');
@@ -839,6 +884,7 @@ ErrorOr<int> ladybird_main(Main::Arguments arguments)
     [[maybe_unused]] bool syntax_highlight = !disable_syntax_highlight;
 
     AK::set_debug_enabled(!disable_debug_printing);
+    JS::Bytecode::g_optimize_bytecode = !disable_bytecode_optimizations;
     s_history_path = TRY(String::formatted("{}/.js-history", Core::StandardPaths::home_directory()));
 
     g_vm_storage.get() = JS::VM::create();
@@ -917,7 +963,10 @@ ErrorOr<int> ladybird_main(Main::Arguments arguments)
 
         // We resolve modules as if it is the first file
 
-        if (!TRY(parse_and_run(realm, builder.string_view(), source_name)))
+        auto success = TRY(parse_and_run(realm, builder.string_view(), source_name));
+        if (JS::Bytecode::g_count_bytecode_bigrams)
+            JS::Bytecode::dump_bytecode_bigram_counts();
+        if (!success)
             return 1;
     }
 
@@ -8,6 +8,7 @@
 #include <AK/GenericLexer.h>
 #include <AK/Hex.h>
 #include <AK/MemoryStream.h>
+#include <AK/QuickSort.h>
 #include <AK/StackInfo.h>
 #include <AK/Utf16String.h>
 #include <LibCore/ArgsParser.h>
@@ -27,6 +28,7 @@
 #include <LibMain/Main.h>
 #include <LibWasm/AbstractMachine/AbstractMachine.h>
 #include <LibWasm/AbstractMachine/BytecodeInterpreter.h>
+#include <LibWasm/AbstractMachine/Profiler.h>
 #include <LibWasm/Printer/Printer.h>
 #include <LibWasm/Types.h>
 #if !defined(AK_OS_WINDOWS)
@@ -293,6 +295,54 @@ static ErrorOr<T, Wasm::Result> trap_for_js_exception(JS::VM& vm, JS::ThrowCompl
     return Wasm::Trap { ByteString("JS exception") };
 }
 
+static ErrorOr<void> report_profile(Wasm::Profiler const& profiler, HashMap<Wasm::FunctionAddress, ByteString> const& names, StringView collapsed_stacks_path)
+{
+    auto name_of = [&](Wasm::FunctionAddress address) -> ByteString {
+        if (auto name = names.get(address); name.has_value())
+            return *name;
+        return ByteString::formatted("#{}", address.value());
+    };
+    auto milliseconds = [](AK::Duration duration) {
+        return static_cast<double>(duration.to_nanoseconds()) / 1'000'000;
+    };
+
+    struct FunctionEntry {
+        Wasm::FunctionAddress address;
+        Wasm::Profiler::FunctionStatistics statistics;
+    };
+    Vector<FunctionEntry> functions;
+    for (auto& entry : profiler.function_statistics())
+        functions.append({ entry.key, entry.value });
+    quick_sort(functions, [](auto& a, auto& b) { return a.statistics.self_time > b.statistics.self_time; });
+
+    warnln("{:>12}  {:>12}  {:>10}  Function", "Self (ms)", "Total (ms)", "Calls");
+    for (auto& entry : functions)
+        warnln("{:>12.3}  {:>12.3}  {:>10}  {}", milliseconds(entry.statistics.self_time), milliseconds(entry.statistics.total_time), entry.statistics.call_count, name_of(entry.address));
+
+    if (profiler.counts_opcodes()) {
+        struct OpcodeEntry {
+            Wasm::OpCode opcode;
+            u64 count { 0 };
+        };
+        Vector<OpcodeEntry> opcodes;
+        profiler.for_each_executed_opcode([&](Wasm::OpCode opcode, u64 count) { opcodes.append({ opcode, count }); });
+        quick_sort(opcodes, [](auto& a, auto& b) { return a.count > b.count; });
+
+        warnln();
+        warnln("{:>12}  Opcode", "Executed");
+        for (auto& entry : opcodes)
+            warnln("{:>12}  {}", entry.count, Wasm::instruction_name(entry.opcode));
+    }
+
+    if (collapsed_stacks_path.is_empty())
+        return {};
+
+    auto collapsed_stacks = profiler.collapsed_stacks(names);
+    auto file = TRY(Core::File::open(collapsed_stacks_path, Core::File::OpenMode::Write | Core::File::OpenMode::Truncate));
+    TRY(file->write_until_depleted(collapsed_stacks.bytes()));
+    return {};
+}
+
 ErrorOr<int> ladybird_main(Main::Arguments arguments)
 {
     StringView filename;
@@ -300,6 +350,9 @@ ErrorOr<int> ladybird_main(Main::Arguments arguments)
     bool print_compiled = false;
     bool attempt_instantiate = false;
     bool export_all_imports = false;
+    bool profile = false;
+    bool profile_opcodes = false;
+    StringView collapsed_stacks_path;
     [[maybe_unused]] bool wasi = false;
     Optional<u64> specific_function_address;
     ByteString exported_function_to_execute;
@@ -322,6 +375,9 @@ ErrorOr<int> ladybird_main(Main::Arguments arguments)
     parser.add_option(attempt_instantiate, "Attempt to instantiate the module", "instantiate", 'i');
     parser.add_option(exported_function_to_execute, "Attempt to execute the named exported function from the module (implies -i)", "execute", 'e', "name");
     parser.add_option(export_all_imports, "Export noop functions corresponding to imports", "export-noop");
+    parser.add_option(profile, "Report self and total time per function of the executed function", "profile");
+    parser.add_option(profile_opcodes, "Also count executed opcodes when profiling (implies --profile)", "profile-opcodes");
+    parser.add_option(collapsed_stacks_path, "Write collapsed call stacks for flame graph tools to a file (implies --profile)", "profile-output", 0, "file");
 #if !defined(AK_OS_WINDOWS)
     parser.add_option(wasi, "Enable WASI", "wasi", 'w');
 #endif
@@ -566,6 +622,9 @@ ErrorOr<int> ladybird_main(Main::Arguments arguments)
     if (!exported_function_to_execute.is_empty())
         attempt_instantiate = true;
 
+    if (profile_opcodes || !collapsed_stacks_path.is_empty())
+        profile = true;
+
     auto parse_result = parse(filename);
     if (parse_result.is_null())
         return 1;
@@ -854,7 +913,22 @@ ErrorOr<int> ladybird_main(Main::Arguments arguments)
                 outln();
             }
 
+            Optional<Wasm::Profiler> profiler;
+            if (profile) {
+                profiler.emplace(profile_opcodes);
+                g_interpreter.set_profiler(&*profiler);
+            }
+
             auto result = machine.invoke(g_interpreter, run_address.value(), move(values));
+
+            if (profiler.has_value()) {
+                g_interpreter.set_profiler(nullptr);
+                HashMap<Wasm::FunctionAddress, ByteString> function_names;
+                Wasm::Profiler::collect_function_names(*parse_result, *module_instance, machine.store(), function_names);
+                for (size_t i = 0; i < linked_modules.size(); ++i)
+                    Wasm::Profiler::collect_function_names(*linked_modules[i], *linked_instances[i], machine.store(), function_names);
+                TRY(report_profile(*profiler, function_names, collapsed_stacks_path));
+            }
             if (result.is_trap()) {
                 auto trap_reason = result.trap().format();
                 if (trap_reason.starts_with("exit:"sv))